@@ -0,0 +1,97 @@
+#include "arena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+void InitArena(Arena *arena, void *base, size_t size) {
+    arena->base = base;
+    arena->size = size;
+    arena->used = 0;
+}
+
+// Retorna NULL se o bloco não tiver mais espaço; alignment deve ser potência de 2
+void *ArenaAlloc(Arena *arena, size_t size, size_t alignment) {
+    uintptr_t start = ((uintptr_t)arena->base + arena->used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    size_t offset = start - (uintptr_t)arena->base;
+
+    if (offset > arena->size || size > arena->size - offset) {
+        return NULL;
+    }
+
+    arena->used = offset + size;
+    return arena->base + offset;
+}
+
+void ResetArena(Arena *arena) {
+    arena->used = 0;
+}
+
+void InitSlabPool(SlabPool *pool, size_t blockSize, size_t blocksPerSlab) {
+    // Cada bloco livre guarda o ponteiro para o próximo
+    size_t alignment = sizeof(void *) > 16 ? sizeof(void *) : 16;
+    pool->blockSize = (blockSize + alignment - 1) & ~(alignment - 1);
+    pool->blocksPerSlab = blocksPerSlab;
+    pool->freeList = NULL;
+    pool->slabs = NULL;
+    pool->slabCount = 0;
+    pool->slabCapacity = 0;
+    pool->liveBlocks = 0;
+}
+
+static int AddSlab(SlabPool *pool) {
+    if (pool->slabCount == pool->slabCapacity) {
+        int capacity = pool->slabCapacity > 0 ? pool->slabCapacity * 2 : 16;
+        unsigned char **slabs = realloc(pool->slabs, capacity * sizeof(unsigned char *));
+        if (slabs == NULL) {
+            return 0;
+        }
+        pool->slabs = slabs;
+        pool->slabCapacity = capacity;
+    }
+
+    unsigned char *slab = malloc(pool->blockSize * pool->blocksPerSlab);
+    if (slab == NULL) {
+        return 0;
+    }
+    pool->slabs[pool->slabCount++] = slab;
+
+    // Encadeia os blocos do slab novo na lista de livres, do último ao primeiro
+    for (size_t i = pool->blocksPerSlab; i > 0; i--) {
+        void *block = slab + (i - 1) * pool->blockSize;
+        *(void **)block = pool->freeList;
+        pool->freeList = block;
+    }
+
+    return 1;
+}
+
+void *SlabAlloc(SlabPool *pool) {
+    if (pool->freeList == NULL && !AddSlab(pool)) {
+        return NULL;
+    }
+
+    void *block = pool->freeList;
+    pool->freeList = *(void **)block;
+    pool->liveBlocks++;
+    return block;
+}
+
+void SlabFree(SlabPool *pool, void *block) {
+    *(void **)block = pool->freeList;
+    pool->freeList = block;
+    pool->liveBlocks--;
+}
+
+// Memória total reservada pelos slabs
+size_t GetSlabPoolBytes(const SlabPool *pool) {
+    return (size_t)pool->slabCount * pool->blocksPerSlab * pool->blockSize;
+}
+
+void DestroySlabPool(SlabPool *pool) {
+    for (int i = 0; i < pool->slabCount; i++) {
+        free(pool->slabs[i]);
+    }
+
+    free(pool->slabs);
+    InitSlabPool(pool, pool->blockSize, pool->blocksPerSlab);
+}
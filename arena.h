@@ -0,0 +1,37 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Alocador linear sobre um bloco de tamanho fixo: alocar é só avançar
+// used, e tudo é liberado de uma vez com ResetArena
+typedef struct {
+    unsigned char *base;
+    size_t size;
+    size_t used;
+} Arena;
+
+// Pool de blocos do mesmo tamanho, reservados em slabs de muitos blocos.
+// Alocar e liberar são O(1) (lista de livres dentro dos próprios blocos);
+// só a criação de um slab novo chama malloc
+typedef struct {
+    size_t blockSize;
+    size_t blocksPerSlab;
+    void *freeList;
+    unsigned char **slabs;
+    int slabCount;
+    int slabCapacity;
+    size_t liveBlocks;
+} SlabPool;
+
+void InitArena(Arena *arena, void *base, size_t size);
+void *ArenaAlloc(Arena *arena, size_t size, size_t alignment);
+void ResetArena(Arena *arena);
+
+void InitSlabPool(SlabPool *pool, size_t blockSize, size_t blocksPerSlab);
+void *SlabAlloc(SlabPool *pool);
+void SlabFree(SlabPool *pool, void *block);
+size_t GetSlabPoolBytes(const SlabPool *pool);
+void DestroySlabPool(SlabPool *pool);
+
+#endif
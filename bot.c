@@ -0,0 +1,564 @@
+#include "bot.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define MCTS_EXPLORATION 1.0  // Peso da exploração no UCT, relativo à média do pai
+#define MCTS_ACTION_WIDENING 2 // Jogadas abertas num nó: k enquanto k * k <= 2 * (visitas + 1)
+#define MCTS_MIN_TREE_NODES 4096 // Menor fatia do pool que vale uma árvore
+#define MCTS_TIME_CHECK 16     // Iterações entre consultas ao relógio
+
+// Mistura (finalizador do splitmix64) para derivar sementes independentes
+static uint64_t MixSeed(uint64_t z) {
+    z += 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static uint64_t NextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+void DecodeMove(int move, int *x1, int *y1, int *x2, int *y2) {
+    int cell = move / 2;
+    *x1 = cell % GRID_WIDTH;
+    *y1 = cell / GRID_WIDTH;
+    *x2 = *x1 + (move % 2 == 0);
+    *y2 = *y1 + (move % 2 == 1);
+}
+
+// Aplica a jogada resolvendo a cascata inteira; false se não formar match
+static bool PlayMove(Board *board, int move) {
+    int x1, y1, x2, y2;
+    CascadeTrace trace;
+
+    DecodeMove(move, &x1, &y1, &x2, &y2);
+    return ResolveAll(board, x1, y1, x2, y2, &trace);
+}
+
+static int GetTypeAt(const Board *board, int x, int y) {
+    return x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT ? board->grid[y][x].type : -1;
+}
+
+// Tipo que a célula teria depois da troca
+static int GetSwappedType(const Board *board, int x, int y, int x1, int y1, int x2, int y2) {
+    if (x == x1 && y == y1) {
+        return GetTypeAt(board, x2, y2);
+    }
+    if (x == x2 && y == y2) {
+        return GetTypeAt(board, x1, y1);
+    }
+    return GetTypeAt(board, x, y);
+}
+
+// Maior sequência (até 5) que passa pela célula (x, y) depois da troca
+static int GetRunLength(const Board *board, int x, int y, int x1, int y1, int x2, int y2) {
+    int type = GetSwappedType(board, x, y, x1, y1, x2, y2);
+    int longest = 0;
+    if (type == -1) {
+        return 0;
+    }
+
+    for (int axis = 0; axis < 2; axis++) {
+        int dx = axis == 0, dy = axis == 1;
+        int run = 1;
+        for (int i = 1; i <= 2 && GetSwappedType(board, x + dx * i, y + dy * i, x1, y1, x2, y2) == type; i++) {
+            run++;
+        }
+        for (int i = 1; i <= 2 && GetSwappedType(board, x - dx * i, y - dy * i, x1, y1, x2, y2) == type; i++) {
+            run++;
+        }
+        if (run > longest) {
+            longest = run;
+        }
+    }
+
+    return longest;
+}
+
+// Maior sequência formada pela troca (0 se a jogada sai da grade). Só as
+// células trocadas podem formar um match novo num tabuleiro parado, então
+// basta olhar as linhas que passam por elas
+static int GetMoveRunLength(const Board *board, int move) {
+    int x1, y1, x2, y2;
+    DecodeMove(move, &x1, &y1, &x2, &y2);
+    if (x2 >= GRID_WIDTH || y2 >= GRID_HEIGHT || GetTypeAt(board, x1, y1) == GetTypeAt(board, x2, y2)) {
+        return 0;
+    }
+
+    int first = GetRunLength(board, x1, y1, x1, y1, x2, y2);
+    int second = GetRunLength(board, x2, y2, x1, y1, x2, y2);
+    return first > second ? first : second;
+}
+
+static bool IsMatchingMove(const Board *board, int move) {
+    return GetMoveRunLength(board, move) >= 3;
+}
+
+// Chave da posição na tabela: o Zobrist da grade e tudo o mais que decide os
+// pontos de uma jogada (combo de partida, pontuação base e o estado dos doces
+// novos: semente e posição de cada coluna)
+static uint64_t GetPositionKey(const Board *board) {
+    uint64_t state = board->spawnSeed;
+
+    state = state * 0x100000001B3ull + (uint32_t)board->comboCount;
+    state = state * 0x100000001B3ull + (uint32_t)board->baseScore;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        state = state * 0x100000001B3ull + board->spawnCount[x];
+    }
+
+    return board->hash ^ MixSeed(state);
+}
+
+// Pontos que a jogada faz, com a cascata inteira. Eles dependem só da chave
+// da posição, então o valor da tabela é exato e o resultado da busca não
+// muda com ela; só as cascatas repetidas deixam de ser resolvidas de novo
+static int64_t GetMoveGain(const Board *board, int move, TranspositionTable *table) {
+    uint64_t key = MixSeed(GetPositionKey(board) ^ (uint64_t)move);
+    TranspositionResult cached;
+
+    if (table != NULL && ProbeTransposition(table, key, &cached) && cached.move == move) {
+        return cached.value;
+    }
+
+    Board after = *board;
+    PlayMove(&after, move);
+    int64_t gain = after.score - board->score;
+    if (table != NULL) {
+        StoreTransposition(table, key, gain, 1, move);
+    }
+    return gain;
+}
+
+// Jogadas que formam match no tabuleiro atual
+int ListValidMoves(const Board *board, int *moves) {
+    int count = 0;
+
+    for (int move = 0; move < BOT_MAX_MOVES; move++) {
+        if (IsMatchingMove(board, move)) {
+            moves[count++] = move;
+        }
+    }
+
+    return count;
+}
+
+// Política das simulações: uma jogada válida qualquer. Tenta algumas
+// sorteadas antes de listar todas. BOT_NO_MOVE se não houver nenhuma
+static int ChooseRandomMove(const Board *board, uint64_t *rng) {
+    for (int attempt = 0; attempt < 16; attempt++) {
+        int move = (int)(NextRandom(rng) % BOT_MAX_MOVES);
+        if (IsMatchingMove(board, move)) {
+            return move;
+        }
+    }
+
+    int moves[BOT_MAX_MOVES];
+    int count = ListValidMoves(board, moves);
+    return count > 0 ? moves[NextRandom(rng) % count] : BOT_NO_MOVE;
+}
+
+// Jogadas aleatórias first..last-1 de uma simulação. Da última só importam
+// os pontos: eles vêm da tabela e a grade fica desatualizada
+static void PlayRandomMoves(Board *board, uint64_t rng, int first, int last, TranspositionTable *table) {
+    for (int i = first; i < last; i++) {
+        uint64_t stepRng = MixSeed(rng + (uint64_t)i) | 1; // Tentativas de um passo não atrasam os seguintes
+        int move = ChooseRandomMove(board, &stepRng);
+        if (move == BOT_NO_MOVE) {
+            break;
+        }
+
+        if (i == last - 1) {
+            board->score += GetMoveGain(board, move, table);
+        } else {
+            PlayMove(board, move);
+        }
+    }
+}
+
+typedef struct {
+    const Board *board;
+    const BotSettings *settings;
+    const int *moves;
+    TranspositionTable *table;
+    Board *afterMoves; // Com o futuro conhecido: o tabuleiro depois de cada candidata
+    int64_t totals[BOT_MAX_MOVES]; // Soma dos pontos por jogada (atômica)
+} RolloutBatch;
+
+// Com o futuro conhecido a cascata da candidata é a mesma em todas as suas
+// simulações, então é resolvida uma vez só, antes delas
+static void PlayCandidate(void *context, int item, int worker) {
+    RolloutBatch *batch = context;
+    Board *board = &batch->afterMoves[item];
+    (void)worker;
+
+    *board = *batch->board;
+    board->onEvent = NULL;
+    board->spawnQueues = NULL; // O cache do original não pode ser dividido entre threads
+    PlayMove(board, batch->moves[item]);
+}
+
+// Uma simulação: a jogada candidata e depth jogadas aleatórias. A semente
+// depende só do índice da simulação, não da jogada: a simulação k de todas
+// as candidatas vê os mesmos doces novos em cada coluna (as filas são
+// geradas por coluna e posição) e a mesma sequência de sorteios da política.
+// Assim a diferença entre duas jogadas vem da jogada e não da sorte, e bem
+// menos simulações bastam para ordená-las
+static void RunRollout(void *context, int item, int worker) {
+    RolloutBatch *batch = context;
+    (void)worker;
+    const BotSettings *settings = batch->settings;
+    int candidate = item / settings->rollouts;
+    int rollout = item % settings->rollouts;
+    uint64_t rng = MixSeed(settings->seed ^ MixSeed((uint64_t)rollout)) | 1;
+
+    Board board;
+    if (batch->afterMoves != NULL) {
+        board = batch->afterMoves[candidate];
+    } else {
+        board = *batch->board;
+        board.onEvent = NULL;
+        board.spawnQueues = NULL; // O cache do original não pode ser dividido entre threads
+        if (!settings->isFutureKnown) {
+            board.spawnSeed = NextRandom(&rng);
+            RefillSpawnQueues(&board);
+        }
+
+        // Sem jogadas depois dela, a candidata é a última e bastam os pontos
+        if (settings->depth == 0) {
+            board.score += GetMoveGain(&board, batch->moves[candidate], batch->table);
+        } else {
+            PlayMove(&board, batch->moves[candidate]);
+        }
+    }
+    PlayRandomMoves(&board, rng, 0, settings->depth, batch->table);
+
+    __atomic_fetch_add(&batch->totals[candidate], board.score - batch->board->score, __ATOMIC_RELAXED);
+}
+
+// Avalia cada jogada válida pela média de pontos em settings->rollouts
+// simulações, espalhadas pelas threads do pool
+void EvaluateMovesMonteCarlo(const Board *board, const BotSettings *settings, WorkerPool *pool, TranspositionTable *table,
+                             BotDecision *decision) {
+    int moves[BOT_MAX_MOVES];
+    // Com o futuro sorteado a cada simulação as posições quase não se repetem
+    // (menos de 4% de acertos): a tabela só custaria tempo
+    if (!settings->isFutureKnown) {
+        table = NULL;
+    }
+    RolloutBatch batch = { board, settings, moves, table, NULL, { 0 } };
+
+    decision->moveCount = ListValidMoves(board, moves);
+    decision->bestMove = BOT_NO_MOVE;
+    decision->bestScore = 0.0;
+    if (decision->moveCount == 0 || settings->rollouts <= 0) {
+        return;
+    }
+
+    // Sem memória para os tabuleiros, cada simulação resolve a candidata
+    if (settings->isFutureKnown && settings->depth > 0) {
+        batch.afterMoves = malloc((size_t)decision->moveCount * sizeof(Board));
+        if (batch.afterMoves != NULL) {
+            RunWorkerPool(pool, PlayCandidate, &batch, decision->moveCount);
+        }
+    }
+    if (table != NULL) {
+        NewTranspositionGeneration(table);
+    }
+
+    RunWorkerPool(pool, RunRollout, &batch, decision->moveCount * settings->rollouts);
+    free(batch.afterMoves);
+
+    for (int i = 0; i < decision->moveCount; i++) {
+        MoveEvaluation *evaluation = &decision->moves[i];
+        evaluation->move = moves[i];
+        evaluation->expectedScore = (double)batch.totals[i] / settings->rollouts;
+
+        if (decision->bestMove == BOT_NO_MOVE || evaluation->expectedScore > decision->bestScore) {
+            decision->bestMove = evaluation->move;
+            decision->bestScore = evaluation->expectedScore;
+        }
+    }
+}
+
+bool InitMctsSearch(MctsSearch *search, int nodeCapacity) {
+    search->nodes = malloc((size_t)nodeCapacity * sizeof(MctsNode));
+    search->nodeCapacity = search->nodes != NULL ? nodeCapacity : 0;
+    return search->nodes != NULL;
+}
+
+void DestroyMctsSearch(MctsSearch *search) {
+    free(search->nodes);
+    search->nodes = NULL;
+    search->nodeCapacity = 0;
+}
+
+// Árvore de uma thread, numa fatia do pool de nós. O nó 0 é a raiz
+typedef struct {
+    MctsNode *nodes;
+    int capacity;
+    int count;
+    uint64_t rng;
+    const MctsSettings *settings;
+    TranspositionTable *table;
+} MctsTree;
+
+static int AllocateNodes(MctsTree *tree, int count) {
+    if (tree->count + count > tree->capacity) {
+        return MCTS_NO_NODE;
+    }
+
+    int first = tree->count;
+    tree->count += count;
+    for (int i = first; i < tree->count; i++) {
+        tree->nodes[i] = (MctsNode){ 0, 0, MCTS_NO_NODE, MCTS_NO_NODE, 0, 0, 0, false };
+    }
+    return first;
+}
+
+// Cria um nó de acaso por jogada válida, ordenados pela maior sequência que
+// a troca forma (5 = explosão). O alargamento progressivo abre os filhos
+// nessa ordem; empates ficam em ordem aleatória
+static bool ExpandDecision(MctsTree *tree, int node, const Board *board) {
+    int moves[BOT_MAX_MOVES];
+    int runs[BOT_MAX_MOVES];
+    int count = ListValidMoves(board, moves);
+
+    for (int i = count - 1; i > 0; i--) {
+        int j = (int)(NextRandom(&tree->rng) % (uint64_t)(i + 1));
+        int move = moves[i];
+        moves[i] = moves[j];
+        moves[j] = move;
+    }
+    for (int i = 0; i < count; i++) {
+        int move = moves[i];
+        int run = GetMoveRunLength(board, move);
+        int j = i;
+        for (; j > 0 && runs[j - 1] < run; j--) {
+            moves[j] = moves[j - 1];
+            runs[j] = runs[j - 1];
+        }
+        moves[j] = move;
+        runs[j] = run;
+    }
+
+    int first = count > 0 ? AllocateNodes(tree, count) : MCTS_NO_NODE;
+    if (count > 0 && first == MCTS_NO_NODE) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        tree->nodes[first + i].move = (short)moves[i];
+        tree->nodes[first + i].nextSibling = i + 1 < count ? first + i + 1 : MCTS_NO_NODE;
+    }
+
+    MctsNode *parent = &tree->nodes[node];
+    parent->firstChild = first;
+    parent->childCount = (unsigned char)count;
+    parent->isExpanded = true;
+    return true;
+}
+
+// UCT entre as jogadas já abertas. Jogadas nunca visitadas vêm primeiro, na
+// ordem da expansão. A exploração é escalada pela média do pai porque os
+// pontos não têm limite fixo
+static int SelectAction(const MctsTree *tree, int node) {
+    const MctsNode *parent = &tree->nodes[node];
+    double parentMean = parent->visits > 0 ? (double)parent->totalScore / parent->visits : 0.0;
+    double exploration = MCTS_EXPLORATION * (parentMean > 1.0 ? parentMean : 1.0);
+    double logVisits = log((double)parent->visits + 1.0);
+    int best = MCTS_NO_NODE;
+    double bestValue = 0.0;
+
+    int opened = 0;
+    for (int child = parent->firstChild; child != MCTS_NO_NODE &&
+         opened * opened <= MCTS_ACTION_WIDENING * (parent->visits + 1); child = tree->nodes[child].nextSibling) {
+        const MctsNode *candidate = &tree->nodes[child];
+        if (candidate->visits == 0) {
+            return child;
+        }
+
+        double value = (double)candidate->totalScore / candidate->visits +
+                       exploration * sqrt(logVisits / candidate->visits);
+        if (best == MCTS_NO_NODE || value > bestValue) {
+            best = child;
+            bestValue = value;
+        }
+        opened++;
+    }
+
+    return best;
+}
+
+// Sorteio dos doces novos de uma jogada. Abre um sorteio novo enquanto
+// sorteios * sorteios <= visitas, senão repete um dos existentes (todos têm a
+// mesma chance). Com o futuro conhecido só há um resultado
+static int SelectOutcome(MctsTree *tree, int chance, bool *isNew) {
+    MctsNode *node = &tree->nodes[chance];
+    int outcomes = node->childCount;
+    *isNew = false;
+
+    if (outcomes == 0 || (!tree->settings->isFutureKnown && outcomes < 0xFF && outcomes * outcomes <= node->visits)) {
+        int child = AllocateNodes(tree, 1);
+        if (child != MCTS_NO_NODE) {
+            tree->nodes[child].spawnSeed = NextRandom(&tree->rng);
+            tree->nodes[child].nextSibling = node->firstChild;
+            node->firstChild = child;
+            node->childCount++;
+            *isNew = true;
+            return child;
+        }
+        if (outcomes == 0) {
+            return MCTS_NO_NODE;
+        }
+    }
+
+    int child = node->firstChild;
+    for (int skip = (int)(NextRandom(&tree->rng) % (uint64_t)outcomes); skip > 0; skip--) {
+        child = tree->nodes[child].nextSibling;
+    }
+    return child;
+}
+
+// Uma iteração: desce pela árvore até um nó novo (ou o horizonte), completa
+// o horizonte com jogadas aleatórias e soma o resultado em cada nó do caminho
+static void RunMctsIteration(MctsTree *tree, const Board *root) {
+    const MctsSettings *settings = tree->settings;
+    int path[2 * MCTS_MAX_HORIZON + 1];
+    int64_t entryScore[2 * MCTS_MAX_HORIZON + 1];
+    int length = 0;
+    int depth = 0;
+    int node = 0;
+
+    Board board = *root;
+    board.onEvent = NULL;
+    board.spawnQueues = NULL;
+    path[length] = node;
+    entryScore[length++] = board.score;
+
+    while (depth < settings->horizon) {
+        if (!tree->nodes[node].isExpanded && !ExpandDecision(tree, node, &board)) {
+            break;
+        }
+
+        int chance = SelectAction(tree, node);
+        if (chance == MCTS_NO_NODE) {
+            break; // Sem jogadas
+        }
+        path[length] = chance;
+        entryScore[length++] = board.score;
+
+        bool isNew;
+        int outcome = SelectOutcome(tree, chance, &isNew);
+        if (!settings->isFutureKnown) {
+            board.spawnSeed = outcome != MCTS_NO_NODE ? tree->nodes[outcome].spawnSeed : NextRandom(&tree->rng);
+            RefillSpawnQueues(&board);
+        }
+        if (depth + 1 == settings->horizon) {
+            board.score += GetMoveGain(&board, tree->nodes[chance].move, tree->table); // Última jogada: só os pontos
+        } else {
+            PlayMove(&board, tree->nodes[chance].move);
+        }
+        depth++;
+
+        if (outcome == MCTS_NO_NODE) {
+            break;
+        }
+        path[length] = outcome;
+        entryScore[length++] = board.score;
+        node = outcome;
+        if (isNew) {
+            break;
+        }
+    }
+
+    PlayRandomMoves(&board, tree->rng, depth, settings->horizon, tree->table);
+    NextRandom(&tree->rng);
+
+    for (int i = 0; i < length; i++) {
+        tree->nodes[path[i]].visits++;
+        tree->nodes[path[i]].totalScore += board.score - entryScore[i];
+    }
+}
+
+typedef struct {
+    const Board *board;
+    const MctsSettings *settings;
+    MctsSearch *search;
+    TranspositionTable *table;
+    int treeNodes;
+    double deadline;
+    int64_t totals[BOT_MAX_MOVES]; // Somas das raízes de todas as árvores (atômicas)
+    int visits[BOT_MAX_MOVES];
+} MctsBatch;
+
+// Uma árvore independente por item (paralelização na raiz). As estatísticas
+// das jogadas da raiz são somadas no fim
+static void RunMctsTree(void *context, int item, int worker) {
+    MctsBatch *batch = context;
+    (void)worker;
+    MctsTree tree = { batch->search->nodes + (size_t)item * batch->treeNodes, batch->treeNodes, 0,
+                      MixSeed(batch->settings->seed ^ MixSeed((uint64_t)item)) | 1, batch->settings, batch->table };
+
+    AllocateNodes(&tree, 1);
+    do {
+        for (int i = 0; i < MCTS_TIME_CHECK; i++) {
+            RunMctsIteration(&tree, batch->board);
+        }
+    } while (GetWallTime() < batch->deadline);
+
+    for (int child = tree.nodes[0].firstChild; child != MCTS_NO_NODE; child = tree.nodes[child].nextSibling) {
+        __atomic_fetch_add(&batch->totals[tree.nodes[child].move], tree.nodes[child].totalScore, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&batch->visits[tree.nodes[child].move], tree.nodes[child].visits, __ATOMIC_RELAXED);
+    }
+}
+
+// Busca em árvore (UCT) até o fim do orçamento de tempo, com uma árvore por
+// thread do pool
+void SearchMovesMcts(MctsSearch *search, const Board *board, const MctsSettings *settings, WorkerPool *pool,
+                     TranspositionTable *table, BotDecision *decision) {
+    int moves[BOT_MAX_MOVES];
+    MctsSettings clamped = *settings;
+    MctsBatch batch = { board, &clamped, search, table, 0, GetWallTime() + settings->timeBudget, { 0 }, { 0 } };
+
+    if (clamped.horizon > MCTS_MAX_HORIZON) {
+        clamped.horizon = MCTS_MAX_HORIZON;
+    }
+
+    decision->moveCount = ListValidMoves(board, moves);
+    decision->bestMove = BOT_NO_MOVE;
+    decision->bestScore = 0.0;
+    if (decision->moveCount == 0 || clamped.horizon <= 0 || search->nodeCapacity < MCTS_MIN_TREE_NODES) {
+        return;
+    }
+
+    int trees = pool->threadCount + 1;
+    if (trees > search->nodeCapacity / MCTS_MIN_TREE_NODES) {
+        trees = search->nodeCapacity / MCTS_MIN_TREE_NODES;
+    }
+    batch.treeNodes = search->nodeCapacity / trees;
+    if (table != NULL) {
+        NewTranspositionGeneration(table);
+    }
+    RunWorkerPool(pool, RunMctsTree, &batch, trees);
+
+    int bestVisits = -1;
+    for (int i = 0; i < decision->moveCount; i++) {
+        MoveEvaluation *evaluation = &decision->moves[i];
+        int visits = batch.visits[moves[i]];
+        evaluation->move = moves[i];
+        evaluation->expectedScore = visits > 0 ? (double)batch.totals[moves[i]] / visits : 0.0;
+
+        if (visits > bestVisits || (visits == bestVisits && evaluation->expectedScore > decision->bestScore)) {
+            decision->bestMove = evaluation->move;
+            decision->bestScore = evaluation->expectedScore;
+            bestVisits = visits;
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "candy.h"
+#include "transposition.h"
+#include "workers.h"
+
+// Jogada = célula * 2 + direção (0 = troca com a da direita, 1 = com a de baixo)
+#define BOT_MAX_MOVES (2 * GRID_CELLS)
+#define BOT_NO_MOVE -1
+#define MCTS_NO_NODE -1
+#define MCTS_MAX_HORIZON 16
+
+typedef struct {
+    int rollouts;       // Simulações por jogada candidata
+    int depth;          // Jogadas aleatórias depois da candidata em cada simulação
+    bool isFutureKnown; // Usa os doces novos reais em vez de sortear outros
+    uint64_t seed;      // Semente das simulações (mesma semente, mesma decisão)
+} BotSettings;
+
+typedef struct {
+    int move;
+    double expectedScore; // Média dos pontos ganhos nas simulações
+} MoveEvaluation;
+
+typedef struct {
+    int bestMove; // BOT_NO_MOVE se nenhuma troca formar match
+    double bestScore;
+    int moveCount;
+    MoveEvaluation moves[BOT_MAX_MOVES];
+} BotDecision;
+
+typedef struct {
+    double timeBudget;  // Segundos por decisão; a busca devolve o que tiver ao fim dele
+    int horizon;        // Jogadas planejadas, somando árvore e simulação
+    bool isFutureKnown; // Usa os doces novos reais (sem nós de acaso)
+    uint64_t seed;
+} MctsSettings;
+
+// Nó da árvore. Nós de decisão (tabuleiro parado, vez do jogador) têm como
+// filhos nós de acaso, um por jogada; nós de acaso têm como filhos nós de
+// decisão, um por sorteio dos doces novos que caem durante a jogada
+typedef struct {
+    int64_t totalScore; // Soma dos pontos ganhos a partir deste nó
+    uint64_t spawnSeed; // Nó de decisão: semente dos doces novos da jogada que levou a ele
+    int firstChild;
+    int nextSibling;
+    int visits;
+    short move;         // Nó de acaso: jogada
+    unsigned char childCount;
+    bool isExpanded;
+} MctsNode;
+
+// Nós reservados uma vez e reaproveitados a cada busca. Cada thread usa uma
+// fatia; com a fatia cheia a árvore para de crescer e a busca segue só com
+// simulações
+typedef struct {
+    MctsNode *nodes;
+    int nodeCapacity;
+} MctsSearch;
+
+void DecodeMove(int move, int *x1, int *y1, int *x2, int *y2);
+int ListValidMoves(const Board *board, int *moves);
+// O tabuleiro precisa estar parado (sem matches pendentes). table guarda os
+// pontos das jogadas já resolvidas, dividida entre as threads e entre buscas;
+// pode ser NULL e só é usada com isFutureKnown
+void EvaluateMovesMonteCarlo(const Board *board, const BotSettings *settings, WorkerPool *pool, TranspositionTable *table,
+                             BotDecision *decision);
+
+bool InitMctsSearch(MctsSearch *search, int nodeCapacity);
+void DestroyMctsSearch(MctsSearch *search);
+// O tabuleiro precisa estar parado. expectedScore de cada jogada é a média
+// dos pontos em horizon jogadas; a escolhida é a mais visitada. table como
+// em EvaluateMovesMonteCarlo, mas usada também com o futuro sorteado: os nós
+// de acaso repetem as sementes
+void SearchMovesMcts(MctsSearch *search, const Board *board, const MctsSettings *settings, WorkerPool *pool,
+                     TranspositionTable *table, BotDecision *decision);
+
+#endif
@@ -0,0 +1,650 @@
+#include "candy.h"
+#include "masks.h"
+
+#include <stdlib.h>
+
+static void EmitEvent(Board *board, GameEventType type, int x, int y, int toY, int candy, int64_t value) {
+    if (board->onEvent != NULL) {
+        GameEvent event = { type, candy, x, y, toY, board->comboCount, value };
+        board->onEvent(&event, board->eventUserData);
+    }
+}
+
+void InitializeBoard(Board *board, uint64_t seed) {
+    board->score = 0;
+    board->highscore = 0;
+    board->comboCount = 0;
+    board->baseScore = 1;
+    board->rngState = seed != 0 ? seed : 0x9E3779B97F4A7C15ull; // xorshift não aceita 0
+    board->onEvent = NULL;
+    board->eventUserData = NULL;
+    board->spawnQueues = NULL;
+    board->stepScore = (ScoreBreakdown){ 0 };
+
+    InitializeGrid(board);
+
+    board->spawnSeed = board->rngState * 0x2545F4914F6CDD1Dull;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        board->spawnCount[x] = 0;
+    }
+    RefillSpawnQueues(board);
+}
+
+void InitializeGrid(Board *board) {
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            board->grid[y][x].type = RandomCandy(board);
+            board->grid[y][x].isMatched = false;
+        }
+    }
+
+    CountColumnHoles(board);
+    board->hash = ComputeBoardHash(board);
+}
+
+// Chave Zobrist de um tipo em uma célula; vazia não altera o hash
+uint64_t GetCellKey(int cell, int type) {
+    return type >= 0 ? zobristKeys[cell][type] : 0;
+}
+
+// Hash completo da grade, para verificar o hash incremental ou iniciá-lo
+// depois de alterar a grade diretamente
+uint64_t ComputeBoardHash(const Board *board) {
+    uint64_t hash = 0;
+
+    for (int i = 0; i < GRID_CELLS; i++) {
+        hash ^= GetCellKey(i, board->grid[i / GRID_WIDTH][i % GRID_WIDTH].type);
+    }
+
+    return hash;
+}
+
+// Recalcula os buracos por coluna a partir da grade, para quem altera a
+// grade diretamente (desfazer, editores de fase)
+void CountColumnHoles(Board *board) {
+    board->dirtyColumns = 0;
+
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        board->columnHoles[x] = 0;
+        for (int y = 0; y < GRID_HEIGHT; y++) {
+            if (board->grid[y][x].type == -1) {
+                board->columnHoles[x]++;
+            }
+        }
+
+        if (board->columnHoles[x] > 0) {
+            board->dirtyColumns |= 1u << x;
+        }
+    }
+}
+
+// Tipo do index-ésimo doce novo da coluna: um hash (finalizador do
+// splitmix64) em vez de um gerador com estado, então cada posição da fila é
+// independente das outras e qualquer ponto do futuro pode ser consultado
+static int SpawnType(uint64_t seed, int x, uint32_t index) {
+    uint64_t z = seed + (uint64_t)(x + 1) * 0x9E3779B97F4A7C15ull + (uint64_t)index * 0xD1B54A32D192ED03ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    return (int)(((z >> 32) * NUM_CANDY_TYPES) >> 32);
+}
+
+// Gera o lote que contém o próximo doce da coluna. O laço não tem
+// dependência entre iterações, mas as multiplicações de 64 bits só
+// vetorizam com flags de CPU mais novas que as dos builds do projeto
+static void FillSpawnBatch(Board *board, int x) {
+    uint32_t start = board->spawnCount[x] - board->spawnCount[x] % SPAWN_BATCH;
+
+    for (int i = 0; i < SPAWN_BATCH; i++) {
+        board->spawnQueues->types[x][i] = (signed char)SpawnType(board->spawnSeed, x, start + i);
+    }
+}
+
+// Refaz os lotes de todas as colunas, para quem liga um cache ao tabuleiro
+// ou altera spawnSeed/spawnCount diretamente (carregar, desfazer)
+void RefillSpawnQueues(Board *board) {
+    if (board->spawnQueues == NULL) {
+        return;
+    }
+
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        FillSpawnBatch(board, x);
+    }
+}
+
+// Consome o próximo doce da coluna, gerando o lote seguinte no fim do atual
+static int NextSpawn(Board *board, int x) {
+    uint32_t index = board->spawnCount[x]++;
+    if (board->spawnQueues == NULL) {
+        return SpawnType(board->spawnSeed, x, index);
+    }
+
+    int type = board->spawnQueues->types[x][index % SPAWN_BATCH];
+    if (board->spawnCount[x] % SPAWN_BATCH == 0) {
+        FillSpawnBatch(board, x);
+    }
+
+    return type;
+}
+
+// Tipo do doce que vai cair na coluna x depois de outros depth doces, sem
+// consumir nada. Permite que a busca da IA conheça o futuro exato quando
+// esse modo estiver ligado
+int PeekSpawn(const Board *board, int x, int depth) {
+    uint32_t index = board->spawnCount[x] + depth;
+
+    if (board->spawnQueues != NULL && index / SPAWN_BATCH == board->spawnCount[x] / SPAWN_BATCH) {
+        return board->spawnQueues->types[x][index % SPAWN_BATCH];
+    }
+
+    return SpawnType(board->spawnSeed, x, index);
+}
+
+// Registra uma célula que acabou de ficar vazia na coluna x
+static void AddHole(Board *board, int x) {
+    board->columnHoles[x]++;
+    board->dirtyColumns |= 1u << x;
+}
+
+// Gerador xorshift64* por tabuleiro, para que cada jogo seja reproduzível
+int RandomCandy(Board *board) {
+    uint64_t x = board->rngState;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    board->rngState = x;
+    return (int)(((x * 0x2545F4914F6CDD1Dull) >> 32) % NUM_CANDY_TYPES);
+}
+
+// Esvazia as células da máscara, percorrendo só os bits ligados. A
+// pontuação adicional sai de uma contagem de bits dos doces destruídos
+static void ClearExplodedCells(Board *board, const uint64_t mask[2]) {
+    int destroyed = 0;
+
+    for (int word = 0; word < 2; word++) {
+        uint64_t hit = 0;
+
+        for (uint64_t bits = mask[word]; bits != 0; bits &= bits - 1) {
+            int cell = word * 64 + __builtin_ctzll(bits);
+            Candy *candy = &board->grid[cell / GRID_WIDTH][cell % GRID_WIDTH];
+
+            if (candy->type != -1) {
+                board->hash ^= GetCellKey(cell, candy->type);
+                candy->type = -1;
+                AddHole(board, cell % GRID_WIDTH);
+                hit |= bits & -bits;
+            }
+        }
+        destroyed += __builtin_popcountll(hit);
+    }
+
+    int64_t points = (int64_t)destroyed * EXPLOSION_SCORE * (board->comboCount + 1);
+    board->score += points;
+    board->stepScore.explodedCells += destroyed;
+    board->stepScore.explosionScore += points;
+}
+
+// Union-find sobre as células: a raiz é sempre a menor célula do conjunto,
+// então ela é a primeira do grupo na ordem linha a linha
+static int FindRoot(unsigned char *parent, int cell) {
+    while (parent[cell] != cell) {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+    return cell;
+}
+
+static void UnionCells(unsigned char *parent, int a, int b) {
+    a = FindRoot(parent, a);
+    b = FindRoot(parent, b);
+    if (a < b) {
+        parent[b] = a;
+    } else if (b < a) {
+        parent[a] = b;
+    }
+}
+
+#define RUN_HORIZONTAL 1 // A célula está em uma sequência horizontal
+#define RUN_H_END 2      // ... e é uma das pontas dela
+#define RUN_VERTICAL 4
+#define RUN_V_END 8
+
+typedef struct {
+    unsigned char start;
+    unsigned char length;
+    unsigned char step; // 1 = horizontal, GRID_WIDTH = vertical
+} MatchRun;
+
+// Marca uma sequência de 3 ou mais e une suas células no mesmo conjunto
+static void AddMatchRun(unsigned char *parent, unsigned char *flags, MatchRun *runs, int *runCount,
+                        int start, int length, int step) {
+    unsigned char inRun = step == 1 ? RUN_HORIZONTAL : RUN_VERTICAL;
+    unsigned char atEnd = step == 1 ? RUN_H_END : RUN_V_END;
+
+    for (int k = 0; k < length; k++) {
+        int cell = start + k * step;
+        flags[cell] |= inRun;
+        if (k == 0 || k == length - 1) {
+            flags[cell] |= atEnd;
+        }
+        UnionCells(parent, start, cell);
+    }
+
+    MatchRun run = { start, length, step };
+    runs[(*runCount)++] = run;
+}
+
+// Encontra os grupos de match: as sequências de 3 ou mais são unidas quando
+// compartilham uma célula, e cada grupo sai com tamanho, forma e caixa
+// envolvente. Retorna o número de grupos
+int FindMatchGroups(const Board *board, MatchGroups *result) {
+    unsigned char parent[GRID_CELLS];
+    unsigned char flags[GRID_CELLS] = { 0 };
+    MatchRun runs[2 * GRID_CELLS / 3];
+    int runCount = 0;
+
+    for (int i = 0; i < GRID_CELLS; i++) {
+        parent[i] = i;
+    }
+
+    // Sequências horizontais
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH - 2;) {
+            int type = board->grid[y][x].type;
+            int matchLength = 1;
+            while (x + matchLength < GRID_WIDTH && board->grid[y][x + matchLength].type == type) {
+                matchLength++;
+            }
+
+            if (type != -1 && matchLength >= 3) {
+                AddMatchRun(parent, flags, runs, &runCount, y * GRID_WIDTH + x, matchLength, 1);
+            }
+            x += matchLength; // Pula as peças já verificadas
+        }
+    }
+
+    // Sequências verticais
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        for (int y = 0; y < GRID_HEIGHT - 2;) {
+            int type = board->grid[y][x].type;
+            int matchLength = 1;
+            while (y + matchLength < GRID_HEIGHT && board->grid[y + matchLength][x].type == type) {
+                matchLength++;
+            }
+
+            if (type != -1 && matchLength >= 3) {
+                AddMatchRun(parent, flags, runs, &runCount, y * GRID_WIDTH + x, matchLength, GRID_WIDTH);
+            }
+            y += matchLength;
+        }
+    }
+
+    // Rotula os grupos na ordem das raízes
+    result->groupCount = 0;
+    for (int i = 0; i < GRID_CELLS; i++) {
+        result->label[i] = NO_MATCH_GROUP;
+        if (flags[i] == 0) {
+            continue;
+        }
+
+        int x = i % GRID_WIDTH;
+        int y = i / GRID_WIDTH;
+        int root = FindRoot(parent, i);
+        MatchGroup *group;
+
+        if (root == i) {
+            result->label[i] = result->groupCount;
+            group = &result->groups[result->groupCount++];
+            group->type = board->grid[y][x].type;
+            group->size = 0;
+            group->shape = MATCH_LINE;
+            group->longestRun = 0;
+            group->minX = group->maxX = x;
+            group->minY = group->maxY = y;
+        } else {
+            result->label[i] = result->label[root];
+            group = &result->groups[result->label[i]];
+        }
+
+        group->size++;
+        if (x < group->minX) {
+            group->minX = x;
+        }
+        if (x > group->maxX) {
+            group->maxX = x;
+        }
+        group->maxY = y; // As células chegam em ordem de linha
+
+        // A forma vem de onde as sequências se cruzam
+        if ((flags[i] & RUN_HORIZONTAL) && (flags[i] & RUN_VERTICAL)) {
+            bool hEnd = (flags[i] & RUN_H_END) != 0;
+            bool vEnd = (flags[i] & RUN_V_END) != 0;
+            MatchShape shape = hEnd && vEnd ? MATCH_L : (hEnd || vEnd ? MATCH_T : MATCH_CROSS);
+            if (shape > group->shape) {
+                group->shape = shape;
+            }
+        }
+    }
+
+    for (int r = 0; r < runCount; r++) {
+        MatchGroup *group = &result->groups[result->label[runs[r].start]];
+        if (runs[r].length > group->longestRun) {
+            int center = runs[r].start + runs[r].length / 2 * runs[r].step;
+            group->longestRun = runs[r].length;
+            group->runX = center % GRID_WIDTH;
+            group->runY = center / GRID_WIDTH;
+        }
+    }
+
+    return result->groupCount;
+}
+
+// Marca os matches e detona as explosões dos grupos com uma sequência de 5
+// ou mais. As áreas são somadas em uma máscara e limpas de uma vez só no
+// fim: uma explosão não apaga a sequência de outro grupo antes de ela ser
+// vista, então o resultado não depende da ordem da varredura
+bool CheckMatches(Board *board) {
+    MatchGroups matches;
+
+    board->stepScore = (ScoreBreakdown){ 0 };
+    if (FindMatchGroups(board, &matches) == 0) {
+        return false;
+    }
+
+    for (int i = 0; i < GRID_CELLS; i++) {
+        if (matches.label[i] != NO_MATCH_GROUP) {
+            board->grid[i / GRID_WIDTH][i % GRID_WIDTH].isMatched = true;
+        }
+    }
+
+    uint64_t cleared[2] = { 0, 0 };
+    for (int g = 0; g < matches.groupCount; g++) {
+        const MatchGroup *group = &matches.groups[g];
+        if (group->longestRun >= 5) {
+            const uint64_t *area = explosionMasks[group->runY * GRID_WIDTH + group->runX];
+
+            EmitEvent(board, EVENT_EXPLOSION, group->runX, group->runY, group->runY, -1, EXPLOSION_RADIUS);
+            cleared[0] |= area[0];
+            cleared[1] |= area[1];
+        }
+    }
+
+    ClearExplodedCells(board, cleared);
+    return true;
+}
+
+// Remove as células marcadas. A varredura ainda passa por todas as células,
+// para emitir os eventos e montar a máscara das removidas; a contagem e a
+// pontuação saem do popcount dessa máscara, uma vez por passo
+void ResolveMatches(Board *board) {
+    uint64_t matched[2] = { 0, 0 };
+
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            if (board->grid[y][x].isMatched) {
+                if (board->grid[y][x].type != -1) {
+                    EmitEvent(board, EVENT_CELL_MATCHED, x, y, y, board->grid[y][x].type, 0);
+                    board->hash ^= GetCellKey(y * GRID_WIDTH + x, board->grid[y][x].type);
+                    AddHole(board, x);
+                }
+
+                board->grid[y][x].type = -1; // Deixa a célula vazia
+                board->grid[y][x].isMatched = false;
+
+                int cell = y * GRID_WIDTH + x;
+                matched[cell / 64] |= 1ull << (cell % 64);
+            }
+        }
+    }
+
+    int matchedCount = __builtin_popcountll(matched[0]) + __builtin_popcountll(matched[1]);
+
+    // Se ao menos uma combinação foi resolvida, aumente o comboCount
+    if (matchedCount > 0) {
+        // Pontuação com base no combo atual
+        int64_t points = (int64_t)matchedCount * board->baseScore * (board->comboCount + 1);
+        board->score += points;
+        board->stepScore.matchedCells += matchedCount;
+        board->stepScore.matchScore += points;
+
+        EmitEvent(board, EVENT_MATCHES_RESOLVED, -1, -1, -1, -1, matchedCount);
+        SetComboCount(board, board->comboCount + 1);
+    }
+
+    if (board->score > board->highscore) {
+        board->highscore = board->score;
+        EmitEvent(board, EVENT_NEW_HIGHSCORE, -1, -1, -1, -1, board->highscore);
+    }
+}
+
+
+void SwapCandies(Board *board, int x1, int y1, int x2, int y2) {
+    int cell1 = y1 * GRID_WIDTH + x1;
+    int cell2 = y2 * GRID_WIDTH + x2;
+    int type1 = board->grid[y1][x1].type;
+    int type2 = board->grid[y2][x2].type;
+    board->hash ^= GetCellKey(cell1, type1) ^ GetCellKey(cell2, type2) ^ GetCellKey(cell1, type2) ^ GetCellKey(cell2, type1);
+
+    Candy temp = board->grid[y1][x1];
+    board->grid[y1][x1] = board->grid[y2][x2];
+    board->grid[y2][x2] = temp;
+
+    // Trocar com um buraco leva o buraco para a outra coluna
+    bool isHole1 = board->grid[y1][x1].type == -1;
+    bool isHole2 = board->grid[y2][x2].type == -1;
+    if (x1 != x2 && isHole1 != isHole2) {
+        int from = isHole1 ? x2 : x1;
+        int to = isHole1 ? x1 : x2;
+        board->columnHoles[from]--;
+        if (board->columnHoles[from] == 0) {
+            board->dirtyColumns &= ~(1u << from);
+        }
+        AddHole(board, to);
+    }
+}
+
+bool IsValidSwap(int x1, int y1, int x2, int y2) {
+    return (abs(x1 - x2) + abs(y1 - y2)) == 1;
+}
+
+// Jogada do jogador: desfaz a troca se ela não formar nenhum match
+bool TrySwap(Board *board, int x1, int y1, int x2, int y2) {
+    if (!IsValidSwap(x1, y1, x2, y2)) {
+        return false;
+    }
+
+    SwapCandies(board, x1, y1, x2, y2);
+    if (!CheckMatches(board)) {
+        SwapCandies(board, x1, y1, x2, y2);
+        return false;
+    }
+
+    ResolveMatches(board);
+
+    // Jogada manual - reseta o combo
+    SetComboCount(board, 0);
+    return true;
+}
+
+// Move as peças para baixo até os buracos; sem nada para mover, gera os
+// doces novos. Só as colunas com buracos são visitadas. Retorna true se
+// alguma peça caiu
+bool DropCandies(Board *board) {
+    bool isDropped = false;
+
+    for (uint32_t columns = board->dirtyColumns; columns != 0; columns &= columns - 1) {
+        int x = __builtin_ctz(columns);
+
+        // Compacta a coluna de baixo para cima
+        int to = GRID_HEIGHT - 1;
+        for (int y = GRID_HEIGHT - 1; y >= 0; y--) {
+            if (board->grid[y][x].type != -1) {
+                if (y != to) {
+                    // Transferir a peça
+                    int type = board->grid[y][x].type;
+                    board->grid[to][x].type = type;
+                    board->grid[y][x].type = -1;
+                    board->hash ^= GetCellKey(y * GRID_WIDTH + x, type) ^ GetCellKey(to * GRID_WIDTH + x, type);
+                    EmitEvent(board, EVENT_CANDY_DROPPED, x, y, to, board->grid[to][x].type, 0);
+                    isDropped = true;
+                }
+                to--;
+            }
+        }
+    }
+
+    if (!isDropped) {
+        GenerateNewCandies(board);
+    }
+
+    return isDropped;
+}
+
+// Preenche os buracos das colunas marcadas; depois de DropCandies eles são
+// as primeiras células da coluna, então só elas são visitadas
+void GenerateNewCandies(Board *board) {
+    for (uint32_t columns = board->dirtyColumns; columns != 0; columns &= columns - 1) {
+        int x = __builtin_ctz(columns);
+        int holes = board->columnHoles[x]; // Empilha as novas peças acima da tela
+
+        for (int y = 0, filled = 0; filled < holes; y++) {
+            if (board->grid[y][x].type == -1) {
+                board->grid[y][x].type = NextSpawn(board, x);
+                board->hash ^= GetCellKey(y * GRID_WIDTH + x, board->grid[y][x].type);
+                EmitEvent(board, EVENT_CANDY_SPAWNED, x, y, y, board->grid[y][x].type, holes);
+                filled++;
+            }
+        }
+
+        board->columnHoles[x] = 0;
+    }
+
+    board->dirtyColumns = 0;
+}
+
+// Resolve a cascata inteira de uma vez, sem animação: queda, reposição e
+// novos matches até o tabuleiro estabilizar. Retorna o número de passos
+int ResolveCascade(Board *board) {
+    int steps = 0;
+
+    for (;;) {
+        while (DropCandies(board)) {
+        }
+
+        if (!CheckMatches(board)) {
+            break;
+        }
+
+        ResolveMatches(board);
+        steps++;
+    }
+
+    // Reseta o combo quando não houver mais matches automáticos
+    SetComboCount(board, 0);
+    return steps;
+}
+
+// Repassa os eventos para o handler original contando as explosões do passo
+typedef struct {
+    BoardEventHandler onEvent;
+    void *eventUserData;
+    int explosions;
+} CascadeTracer;
+
+static void OnTracedEvent(const GameEvent *event, void *userData) {
+    CascadeTracer *tracer = userData;
+
+    if (event->type == EVENT_EXPLOSION) {
+        tracer->explosions++;
+    }
+    if (tracer->onEvent != NULL) {
+        tracer->onEvent(event, tracer->eventUserData);
+    }
+}
+
+static void GetOccupiedMask(const Board *board, uint64_t mask[2]) {
+    mask[0] = 0;
+    mask[1] = 0;
+
+    for (int i = 0; i < GRID_CELLS; i++) {
+        if (board->grid[i / GRID_WIDTH][i % GRID_WIDTH].type != -1) {
+            mask[i / 64] |= 1ull << (i % 64);
+        }
+    }
+}
+
+// Procura e remove os matches, gravando o passo no trace. Retorna false se
+// não havia match
+static bool TraceCascadeStep(Board *board, CascadeTrace *trace, CascadeTracer *tracer) {
+    uint64_t before[2], after[2];
+    int combo = board->comboCount;
+
+    GetOccupiedMask(board, before);
+    tracer->explosions = 0;
+
+    if (!CheckMatches(board)) {
+        return false;
+    }
+    ResolveMatches(board);
+
+    trace->totalScore += board->stepScore.matchScore + board->stepScore.explosionScore;
+    if (trace->stepCount >= CASCADE_MAX_STEPS) {
+        trace->isTruncated = true;
+        trace->stepCount++;
+        return true;
+    }
+
+    GetOccupiedMask(board, after);
+    CascadeStep *step = &trace->steps[trace->stepCount++];
+    step->cleared[0] = before[0] & ~after[0];
+    step->cleared[1] = before[1] & ~after[1];
+    step->score = board->stepScore;
+    step->explosions = (short)tracer->explosions;
+    step->combo = (short)combo;
+    return true;
+}
+
+// Jogada completa em uma chamada: troca, match, remoção, queda e reposição
+// até o tabuleiro estabilizar, com as mesmas regras de TrySwap seguido de
+// ResolveCascade. Retorna false (tabuleiro intacto) se a troca não formar
+// match
+bool ResolveAll(Board *board, int x1, int y1, int x2, int y2, CascadeTrace *trace) {
+    trace->stepCount = 0;
+    trace->totalScore = 0;
+    trace->isTruncated = false;
+
+    if (!IsValidSwap(x1, y1, x2, y2)) {
+        return false;
+    }
+
+    CascadeTracer tracer = { board->onEvent, board->eventUserData, 0 };
+    board->onEvent = OnTracedEvent;
+    board->eventUserData = &tracer;
+
+    SwapCandies(board, x1, y1, x2, y2);
+    bool isValid = TraceCascadeStep(board, trace, &tracer);
+
+    if (isValid) {
+        SetComboCount(board, 0); // Jogada manual - reseta o combo
+
+        do {
+            while (DropCandies(board)) {
+            }
+        } while (TraceCascadeStep(board, trace, &tracer));
+
+        SetComboCount(board, 0);
+    } else {
+        SwapCandies(board, x1, y1, x2, y2);
+    }
+
+    board->onEvent = tracer.onEvent;
+    board->eventUserData = tracer.eventUserData;
+    return isValid;
+}
+
+void SetComboCount(Board *board, int combo) {
+    if (combo != board->comboCount) {
+        board->comboCount = combo;
+        EmitEvent(board, EVENT_COMBO_CHANGED, -1, -1, -1, -1, combo);
+    }
+}
@@ -0,0 +1,134 @@
+#ifndef CANDY_H
+#define CANDY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "events.h"
+
+#define GRID_WIDTH 10      // Largura da grade
+#define GRID_HEIGHT 10     // Altura da grade
+#define GRID_CELLS (GRID_WIDTH * GRID_HEIGHT) // Total de células
+#define NUM_CANDY_TYPES 5 // Tipos de doces
+#define EXPLOSION_RADIUS 2 // Raio da explosão 5x5
+#define EXPLOSION_SCORE 25 // Pontuação por doce destruído na explosão
+#define CASCADE_MAX_STEPS 32 // Passos guardados no trace de uma jogada
+#define MAX_MATCH_GROUPS (GRID_CELLS / 3) // Cada grupo tem ao menos 3 células
+#define NO_MATCH_GROUP 0xFF
+#define SPAWN_BATCH 16 // Doces novos gerados de uma vez por coluna
+
+
+// Compacto (2 bytes) para caber muitos tabuleiros na memória
+typedef struct {
+    signed char type;
+    bool isMatched;
+} Candy;
+
+// Pontuação de um passo (match + explosões), calculada por contagem de bits
+typedef struct {
+    int matchedCells;
+    int explodedCells;
+    int64_t matchScore;
+    int64_t explosionScore;
+} ScoreBreakdown;
+
+// Lote atual dos doces novos de cada coluna. É só um cache: os tipos são
+// função de spawnSeed, da coluna e de spawnCount, então fica fora do Board
+// (não vai para snapshots, sessões nem checkpoints) e é refeito por
+// RefillSpawnQueues
+typedef struct {
+    signed char types[GRID_WIDTH][SPAWN_BATCH];
+} SpawnQueues;
+
+// Recebe cada evento emitido pelas regras
+typedef void (*BoardEventHandler)(const GameEvent *event, void *userData);
+
+// Estado completo de um jogo; as regras não usam globais, então vários
+// tabuleiros podem existir no mesmo processo
+typedef struct {
+    Candy grid[GRID_HEIGHT][GRID_WIDTH]; // Grade do jogo
+    int64_t score;   // 64 bits para sessões longas não estourarem
+    int64_t highscore;
+    int comboCount;  // Rastreia o número de combos consecutivos
+    int baseScore;   // Pontuação base para cada doce eliminado
+    uint64_t rngState;                     // Grade inicial
+    unsigned char columnHoles[GRID_WIDTH]; // Células vazias de cada coluna
+    uint32_t dirtyColumns;                 // Colunas com buracos (bit = x)
+    uint64_t hash;                         // Zobrist da grade, mantido a cada mudança
+
+    // Doces novos: cada coluna tem sua própria sequência, função só da
+    // semente, da coluna e de quantos doces a coluna já recebeu
+    uint64_t spawnSeed;
+    uint32_t spawnCount[GRID_WIDTH];
+
+    BoardEventHandler onEvent; // Pode ser NULL
+    void *eventUserData;
+    SpawnQueues *spawnQueues;  // Pode ser NULL: cada doce é calculado na hora
+
+    ScoreBreakdown stepScore; // Último passo de CheckMatches/ResolveMatches
+} Board;
+
+// Os eventos guardam as células em um byte
+typedef char GridFitsInEvent[GRID_WIDTH <= 127 && GRID_HEIGHT <= 127 ? 1 : -1];
+typedef char GridFitsInDirtyColumns[GRID_WIDTH <= 32 ? 1 : -1];
+
+typedef enum {
+    MATCH_LINE,  // Uma sequência reta
+    MATCH_L,     // Sequências que se cruzam nas pontas
+    MATCH_T,     // A ponta de uma cruza o meio da outra
+    MATCH_CROSS  // Sequências que se cruzam no meio
+} MatchShape;
+
+// Sequências do mesmo tipo que se cruzam formam um único grupo
+typedef struct {
+    signed char type;
+    unsigned char size;       // Células do grupo
+    unsigned char shape;      // MatchShape
+    unsigned char longestRun; // Maior sequência reta do grupo
+    unsigned char runX, runY; // Centro da maior sequência
+    unsigned char minX, minY, maxX, maxY; // Caixa envolvente
+} MatchGroup;
+
+typedef struct {
+    int groupCount;
+    unsigned char label[GRID_CELLS]; // Grupo de cada célula ou NO_MATCH_GROUP
+    MatchGroup groups[MAX_MATCH_GROUPS];
+} MatchGroups;
+
+// Um passo da cascata: match -> remoção (com explosões), antes da queda
+typedef struct {
+    uint64_t cleared[2]; // Células esvaziadas (bit = y * GRID_WIDTH + x)
+    ScoreBreakdown score;
+    short explosions;
+    short combo;         // Combo usado na pontuação do passo
+} CascadeStep;
+
+// Resultado completo de uma jogada resolvida por ResolveAll
+typedef struct {
+    int stepCount;       // Passos da cascata, incluindo o match da troca
+    int64_t totalScore;  // Soma das pontuações dos passos
+    bool isTruncated;    // Mais de CASCADE_MAX_STEPS passos (os extras não são guardados)
+    CascadeStep steps[CASCADE_MAX_STEPS];
+} CascadeTrace;
+
+
+void InitializeBoard(Board *board, uint64_t seed);
+void InitializeGrid(Board *board);
+int RandomCandy(Board *board);
+int FindMatchGroups(const Board *board, MatchGroups *result);
+bool CheckMatches(Board *board);
+void ResolveMatches(Board *board);
+void SwapCandies(Board *board, int x1, int y1, int x2, int y2);
+bool IsValidSwap(int x1, int y1, int x2, int y2);
+bool TrySwap(Board *board, int x1, int y1, int x2, int y2);
+bool DropCandies(Board *board);
+void GenerateNewCandies(Board *board);
+void CountColumnHoles(Board *board);
+uint64_t GetCellKey(int cell, int type);
+uint64_t ComputeBoardHash(const Board *board);
+void RefillSpawnQueues(Board *board);
+int PeekSpawn(const Board *board, int x, int depth);
+int ResolveCascade(Board *board);
+bool ResolveAll(Board *board, int x1, int y1, int x2, int y2, CascadeTrace *trace);
+void SetComboCount(Board *board, int combo);
+
+#endif
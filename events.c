@@ -0,0 +1,58 @@
+#include "events.h"
+
+// Lado do produtor: publica o evento e só então avança head (release)
+bool PushEvent(EventQueue *queue, GameEvent event) {
+    unsigned int head = queue->head;
+    unsigned int tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= EVENT_QUEUE_CAPACITY) {
+        queue->dropped++;
+        return false;
+    }
+
+    queue->events[head & (EVENT_QUEUE_CAPACITY - 1)] = event;
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Lado do consumidor: copia até maxEvents eventos em lote e libera o espaço
+int PopEvents(EventQueue *queue, GameEvent *out, int maxEvents) {
+    unsigned int tail = queue->tail;
+    unsigned int head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    int count = 0;
+
+    while (tail != head && count < maxEvents) {
+        out[count++] = queue->events[tail & (EVENT_QUEUE_CAPACITY - 1)];
+        tail++;
+    }
+
+    __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+    return count;
+}
+
+bool PushInput(InputQueue *queue, InputEvent input) {
+    unsigned int head = queue->head;
+    unsigned int tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail >= INPUT_QUEUE_CAPACITY) {
+        return false;
+    }
+
+    queue->events[head & (INPUT_QUEUE_CAPACITY - 1)] = input;
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+int PopInputs(InputQueue *queue, InputEvent *out, int maxInputs) {
+    unsigned int tail = queue->tail;
+    unsigned int head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    int count = 0;
+
+    while (tail != head && count < maxInputs) {
+        out[count++] = queue->events[tail & (INPUT_QUEUE_CAPACITY - 1)];
+        tail++;
+    }
+
+    __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+    return count;
+}
@@ -0,0 +1,68 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define EVENT_QUEUE_CAPACITY 4096 // Capacidade da fila (potência de 2)
+#define INPUT_QUEUE_CAPACITY 64   // Capacidade da fila de entrada (potência de 2)
+
+// Eventos emitidos pelas regras do jogo; áudio, renderização, telemetria
+// e persistência reagem a eles sem que o núcleo conheça esses sistemas
+typedef enum {
+    EVENT_CELL_MATCHED,     // x, y, candy: doce eliminado por um match
+    EVENT_EXPLOSION,        // x, y: centro de uma explosão
+    EVENT_CANDY_DROPPED,    // x, y -> toY, candy: peça que caiu na coluna
+    EVENT_CANDY_SPAWNED,    // x, y, candy, value = buracos acima na coluna
+    EVENT_MATCHES_RESOLVED, // value = doces eliminados, combo = combo atual
+    EVENT_COMBO_CHANGED,    // combo = novo valor do combo
+    EVENT_NEW_HIGHSCORE     // value = novo highscore
+} GameEventType;
+
+// 16 bytes: células em um byte cada para o valor caber em 64 bits (scores)
+typedef struct {
+    unsigned char type; // GameEventType
+    signed char candy;  // Tipo do doce envolvido (-1 se não houver)
+    signed char x;
+    signed char y;
+    signed char toY;
+    short combo;
+    int64_t value;
+} GameEvent;
+
+// Fila circular sem locks para um produtor e um consumidor: apenas o
+// produtor escreve head e apenas o consumidor escreve tail
+typedef struct {
+    GameEvent events[EVENT_QUEUE_CAPACITY];
+    unsigned int head;
+    unsigned int tail;
+    unsigned int dropped; // Eventos descartados com a fila cheia
+} EventQueue;
+
+typedef enum {
+    INPUT_CLICK,
+    INPUT_UNDO,
+    INPUT_REDO
+} InputType;
+
+// Comando do jogador (clique em uma célula, desfazer ou refazer), enviado da
+// renderização para a simulação
+typedef struct {
+    short type;
+    short gridX;
+    short gridY;
+} InputEvent;
+
+// Mesma fila sem locks de um produtor e um consumidor, para a entrada
+typedef struct {
+    InputEvent events[INPUT_QUEUE_CAPACITY];
+    unsigned int head;
+    unsigned int tail;
+} InputQueue;
+
+bool PushEvent(EventQueue *queue, GameEvent event);
+int PopEvents(EventQueue *queue, GameEvent *out, int maxEvents);
+bool PushInput(InputQueue *queue, InputEvent input);
+int PopInputs(InputQueue *queue, InputEvent *out, int maxInputs);
+
+#endif
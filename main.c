@@ -2,67 +2,236 @@
 #include <stdlib.h>
 #include <time.h>
 #include <stdio.h>
+#include <string.h>
+#include "candy.h"
+#include "events.h"
+#include "masks.h"
+#include "pak.h"
+#include "snapshot.h"
+#include "undo.h"
+#include "startup.h"
+#include "workers.h"
+
+// Build com os recursos embutidos no executável (make compileEmbedded)
+#ifdef EMBED_RESOURCES
+#include "resources_embedded.h"
+#endif
 
-#define GRID_WIDTH 10      // Largura da grade
-#define GRID_HEIGHT 10     // Altura da grade
 #define CELL_SIZE 50      // Tamanho das células
-#define NUM_CANDY_TYPES 5 // Tipos de doces
 #define SELECTED_SIZE 40  // Tamanho da peça selecionada
-#define FALL_SPEED 0.1f   // Velocidade de queda
-#define EXPLOSION_RADIUS 2 // Raio da explosão 5x5
+#define FALL_SPEED 0.1f   // Intervalo da lógica de queda (segundos)
+#define FALL_GRAVITY 3000.0f // Aceleração da animação de queda (pixels/s²)
+#define MAX_PARTICLES 4096 // Capacidade fixa do pool de partículas
+#define PARTICLE_GRAVITY 900.0f // Aceleração das partículas (pixels/s²)
+#define POP_PARTICLES 4 // Partículas por doce eliminado
+#define EXPLOSION_PARTICLES 2 // Partículas por célula atingida pela explosão
+#define POP_VOICES 8 // Vozes simultâneas do som de pop
+#define POP_PITCH_STEP 0.08f // Aumento do pitch por nível de combo
+#define POP_MAX_PITCH 2.0f
+#define POP_BASE_VOLUME 0.6f
+#define POP_VOLUME_STEP 0.1f // Aumento do volume por nível de combo
+#define SIM_TICK (1.0 / 120.0) // Passo fixo da simulação (segundos)
+#define SNAPSHOT_FRESH 4 // Marca um snapshot ainda não lido no buffer triplo
+
+
+Board board; // Tabuleiro do jogo
+SpawnQueues spawnQueues; // Cache dos doces novos do tabuleiro do jogo
+
+// Animação de queda em vetores empacotados (índice = y * GRID_WIDTH + x),
+// atualizados a cada passo da simulação, desacoplados do timer da lógica
+DropPhase dropPhase;
+float slotY[GRID_CELLS]; // Posição de repouso de cada célula (pixels)
+
+// Pool de partículas com capacidade fixa em estrutura de vetores (SoA):
+// nada é alocado por efeito e as partículas mortas são compactadas no fim
+typedef struct {
+    float x[MAX_PARTICLES];
+    float y[MAX_PARTICLES];
+    float velX[MAX_PARTICLES];
+    float velY[MAX_PARTICLES];
+    float gravity[MAX_PARTICLES]; // Aceleração vertical (pixels/s²)
+    float life[MAX_PARTICLES];    // Tempo de vida restante (segundos)
+    float maxLife[MAX_PARTICLES]; // Tempo de vida inicial (para o fade)
+    float size[MAX_PARTICLES];
+    Color color[MAX_PARTICLES];
+    int count;
+} ParticlePool;
+
+ParticlePool particles;
+
+// Eventos das regras, publicados pela thread de simulação e consumidos uma
+// vez por frame por áudio, renderização, persistência e telemetria
+EventQueue gameEvents;
+
+// Cliques enviados pela thread de renderização para a simulação
+InputQueue inputQueue;
+
+// Estado imutável do tabuleiro publicado a cada passo da simulação
+typedef struct {
+    signed char types[GRID_CELLS];
+    float candyY[GRID_CELLS];
+    int64_t score;
+    int64_t highscore;
+    int comboCount;
+    int selectedX;
+    int selectedY;
+    double time; // Momento em que o passo terminou (GetWallTime)
+} BoardSnapshot;
+
+// Buffer triplo: a simulação escreve em back, a renderização lê front e os
+// dois trocam de slot com ready atomicamente, sem nunca esperar um pelo outro
+typedef struct {
+    BoardSnapshot slots[3];
+    int back;  // Apenas a simulação
+    int ready; // Compartilhado: índice | SNAPSHOT_FRESH
+    int front; // Apenas a renderização
+} SnapshotBuffer;
+
+SnapshotBuffer snapshots = { .back = 0, .ready = 1, .front = 2 };
+BoardSnapshot previousSnapshot; // Snapshot anterior, para interpolar
+bool isSimulationRunning = true;
+
+typedef struct {
+    long matchedCells;
+    long explosions;
+    long drops;
+    long spawns;
+    int maxCombo;
+} Telemetry;
 
+Telemetry telemetry;
 
+// Aliases pré-alocados que compartilham o buffer do Pop.wav; a próxima voz
+// é escolhida em round-robin, interrompendo a mais antiga se necessário
 typedef struct {
-    int type;
-    bool isMatched;
-    bool isFallingOrSelected;
-    float fallingY; // Posição animada
-} Candy;
+    Sound source;
+    Sound voices[POP_VOICES];
+    int next;
+} VoicePool;
 
+VoicePool popVoices;
 
-Candy grid[GRID_HEIGHT][GRID_WIDTH]; // Grade do jogo
-int score = 0;
-int highscore = 0;
-bool isDropping = false;
-float dropTimer = 0.0f; // Timer para controlar o tempo de queda
+StartupProfile startupProfile;
+Wave popWave;           // Decodificado por DecodePopTask
+bool popWaveOwned;      // false se os dados apontam para o arquivo mapeado
+int64_t loadedHighscore; // Lido por LoadHighscoreTask
 
-int comboCount = 0;  // Rastreia o número de combos consecutivos
-int baseScore = 1;  // Pontuação base para cada doce eliminado
+// Estado da simulação (junto com board e dropPhase): acessado apenas pela
+// thread de simulação depois que ela inicia
+int selectedX = -1, selectedY = -1;
+
+// Desfazer/refazer: a jogada fica aberta da troca até o tabuleiro assentar
+#define UNDO_BUFFER_SIZE (16 * 1024)
+unsigned char undoBuffer[UNDO_BUFFER_SIZE];
+UndoHistory undoHistory;
+UndoCheckpoint moveStart;
+bool isMoveOpen = false;
+
+char highscorePath[512];
+char savePath[512]; // Jogo salvo ao sair e retomado ao abrir
 
 
 // Protótipos das funções
-void InitializeGrid();
-void DrawGameGrid(int selectedX, int selectedY);
-bool CheckMatches();
-void ResolveMatches();
-void SwapCandies(int x1, int y1, int x2, int y2);
-bool IsValidSwap(int x1, int y1, int x2, int y2);
-void DropCandies(float deltaTime);
-void FillGrid();
-void GenerateNewCandies();
+void DrawGameGrid(const BoardSnapshot *current, const BoardSnapshot *previous, float alpha);
+bool UpdateFallAnimation(float deltaTime);
+void SpawnParticles(int cellX, int cellY, int amount, Color color, float size, float speed, float gravity, float life);
+void UpdateParticles(float deltaTime);
+void DrawParticles();
+void InitFallAnimation();
+void OnBoardEvent(const GameEvent *event, void *userData);
+void ProcessEvents();
+void AnimationHandleEvent(const GameEvent *event);
+void InitVoicePool(VoicePool *pool, Sound source);
+void PlayPooledVoice(VoicePool *pool, int combo);
+void UnloadVoicePool(VoicePool *pool);
+void LoadWindowIcon(const Pak *pak);
+Wave DecodePopWave(const Pak *pak, bool *owned);
+void *InitializeGridTask(void *arg);
+void *InitAudioTask(void *arg);
+void *DecodePopTask(void *arg);
+void *LoadHighscoreTask(void *arg);
+void SaveGame();
+bool LoadSavedGame();
+void HandleClick(int gridX, int gridY);
+void HandleInput(const InputEvent *input);
+bool IsBoardSettled();
+void SimulationStep(float deltaTime);
+void *SimulationThread(void *arg);
+void PublishSnapshot(double time);
+bool AcquireSnapshot();
+
+// No build embutido os arquivos de dados ficam ao lado do executável, sem
+// depender do diretório de trabalho. Os caminhos são montados na thread
+// principal, antes das threads de inicialização
+void BuildDataPath(char *path, size_t size, const char *fileName) {
+#ifdef EMBED_RESOURCES
+    snprintf(path, size, "%s%s", GetApplicationDirectory(), fileName);
+#else
+    snprintf(path, size, "resources/%s", fileName);
+#endif
+}
 
 // Função para salvar o *highscore* em um arquivo
-void SaveHighscore(int highscore) {
-    FILE *file = fopen("resources/CandyHighscore.txt", "w");
+void SaveHighscore(int64_t highscore) {
+    FILE *file = fopen(highscorePath, "w");
     if (file != NULL) {
-        fprintf(file, "%d\n", highscore);
+        fprintf(file, "%lld\n", (long long)highscore);
         fclose(file);
-        printf("Highscore salvo: %d\n", highscore);
+        printf("Highscore salvo: %lld\n", (long long)highscore);
     } else {
         printf("Erro ao salvar o highscore.\n");
     }
 }
 
+// Salva o jogo em andamento (tabuleiro, RNG e fase da queda) para retomá-lo
+void SaveGame() {
+    unsigned char buffer[SNAPSHOT_MAX_SIZE];
+    size_t size = SaveSnapshot(&board, &dropPhase, buffer, sizeof(buffer));
+
+    FILE *file = fopen(savePath, "wb");
+    if (file != NULL) {
+        fwrite(buffer, 1, size, file);
+        fclose(file);
+    } else {
+        printf("Erro ao salvar o jogo.\n");
+    }
+}
+
+// Retoma o jogo salvo; um arquivo inválido é ignorado e o jogo começa do zero
+bool LoadSavedGame() {
+    unsigned char buffer[SNAPSHOT_MAX_SIZE];
+    FILE *file = fopen(savePath, "rb");
+
+    if (file == NULL) {
+        return false;
+    }
+
+    size_t size = fread(buffer, 1, sizeof(buffer), file);
+    fclose(file);
+
+    if (!LoadSnapshot(&board, &dropPhase, buffer, size)) {
+        printf("Jogo salvo invalido, iniciando um novo.\n");
+        return false;
+    }
+
+    printf("Jogo salvo carregado.\n");
+    return true;
+}
+
 // Função para carregar o *highscore* do arquivo
-int LoadHighscore() {
-    FILE *file = fopen("resources/CandyHighscore.txt", "r");
-    int highscore = 0;
+int64_t LoadHighscore() {
+    FILE *file = fopen(highscorePath, "r");
+    long long highscore = 0;
 
     if (file != NULL) {
-        fscanf(file, "%d", &highscore);
+        fscanf(file, "%lld", &highscore);
         fclose(file);
-        printf("Highscore carregado: %d\n", highscore);
+        printf("Highscore carregado: %lld\n", highscore);
     } else {
+#ifdef EMBED_RESOURCES
+        // Valor padrão embutido
+        sscanf((const char *)CandyHighscore_txt, "%lld", &highscore);
+#endif
         printf("Nenhum highscore salvo encontrado.\n");
     }
 
@@ -71,82 +240,132 @@ int LoadHighscore() {
 
 
 int main() {
+    BeginStartupProfile(&startupProfile);
+
+    // Recursos pré-decodificados e mapeados em memória (make pack); sem o
+    // arquivo, os recursos são carregados e decodificados individualmente
+    int step = BeginStartupStep(&startupProfile, "OpenPak");
+    Pak pak = { 0 };
+#ifndef EMBED_RESOURCES
+    OpenPak(PAK_FILE, &pak);
+#endif
+    EndStartupStep(&startupProfile, step);
+
+    BuildDataPath(highscorePath, sizeof(highscorePath), "CandyHighscore.txt");
+    BuildDataPath(savePath, sizeof(savePath), "CandySave.bin");
+
+    // O que não depende da janela roda em threads enquanto ela é criada
+    StartupTask gridTask, audioTask, popTask, highscoreTask;
+    StartStartupTask(&gridTask, InitializeGridTask, NULL);
+    StartStartupTask(&audioTask, InitAudioTask, NULL);
+    StartStartupTask(&popTask, DecodePopTask, &pak);
+    StartStartupTask(&highscoreTask, LoadHighscoreTask, NULL);
+
+    step = BeginStartupStep(&startupProfile, "InitWindow");
     InitWindow(GRID_WIDTH * CELL_SIZE, GRID_HEIGHT * CELL_SIZE + 40, "Candyboom");
-    SetWindowIcon(LoadImage("resources/iconeCandy.png"));
+    EndStartupStep(&startupProfile, step);
+
+    step = BeginStartupStep(&startupProfile, "LoadWindowIcon");
+    LoadWindowIcon(&pak);
     SetTargetFPS(60);
-    srand(time(NULL));
+    EndStartupStep(&startupProfile, step);
+
+    WaitStartupTask(&gridTask);
+    WaitStartupTask(&highscoreTask);
+    WaitStartupTask(&audioTask);
+    WaitStartupTask(&popTask);
+    if (loadedHighscore > board.highscore) {
+        board.highscore = loadedHighscore;
+    }
 
-    InitializeGrid();
-    InitAudioDevice();
+    // Só copia as amostras já decodificadas para o buffer de áudio
+    step = BeginStartupStep(&startupProfile, "LoadSoundFromWave");
+    InitVoicePool(&popVoices, LoadSoundFromWave(popWave));
+    if (popWaveOwned) {
+        UnloadWave(popWave);
+    }
+    ClosePak(&pak);
+    EndStartupStep(&startupProfile, step);
+
+    // O primeiro snapshot é publicado antes da simulação começar
+    PublishSnapshot(GetWallTime());
+    AcquireSnapshot();
+    previousSnapshot = snapshots.slots[snapshots.front];
 
-    Sound pop = LoadSound("resources/Pop.wav");
-    highscore = LoadHighscore();
+    pthread_t simulationThread;
+    pthread_create(&simulationThread, NULL, SimulationThread, NULL);
 
-    int selectedX = -1, selectedY = -1;
+    bool isFirstFrame = true;
 
     while (!WindowShouldClose()) {
         float deltaTime = GetFrameTime();
 
-        BeginDrawing();
-        ClearBackground(BLACK);
-
-        if (!isDropping && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        // A entrada só é repassada; as regras rodam na thread de simulação
+        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
             Vector2 mousePos = GetMousePosition();
-            int gridX = mousePos.x / CELL_SIZE;
-            int gridY = mousePos.y / CELL_SIZE;
-
-            if (gridX >= 0 && gridX < GRID_WIDTH && gridY >= 0 && gridY < GRID_HEIGHT) {
-                if (selectedX == -1 && selectedY == -1) {
-                    selectedX = gridX;
-                    selectedY = gridY;
-                } else {
-                    if (IsValidSwap(selectedX, selectedY, gridX, gridY)) {
-                        SwapCandies(selectedX, selectedY, gridX, gridY);
-                        if (!CheckMatches()) {
-                            SwapCandies(selectedX, selectedY, gridX, gridY);
-                        } else {
-                            ResolveMatches();
-                            PlaySound(pop);
-
-                            // Jogada manual - reseta o combo
-                            comboCount = 0;
-                        }
-                    }
-                    selectedX = -1;
-                    selectedY = -1;
-                }
-            }
+            InputEvent input = { INPUT_CLICK, mousePos.x / CELL_SIZE, mousePos.y / CELL_SIZE };
+            PushInput(&inputQueue, input);
         }
-
-        // Matches automáticos - combos consecutivos
-        if (CheckMatches()) {
-            ResolveMatches();
-            PlaySound(pop);
-        } else if (!isDropping) {
-            // Reseta o combo quando não houver mais matches automáticos
-            comboCount = 0;
+        if (IsKeyPressed(KEY_Z)) {
+            InputEvent input = { INPUT_UNDO, 0, 0 };
+            PushInput(&inputQueue, input);
+        }
+        if (IsKeyPressed(KEY_Y)) {
+            InputEvent input = { INPUT_REDO, 0, 0 };
+            PushInput(&inputQueue, input);
         }
 
-        dropTimer += deltaTime;
-        if (dropTimer >= FALL_SPEED) {
-            DropCandies(deltaTime);
-            dropTimer = 0.0f;
+        BoardSnapshot last = snapshots.slots[snapshots.front];
+        if (AcquireSnapshot()) {
+            previousSnapshot = last;
         }
+        const BoardSnapshot *current = &snapshots.slots[snapshots.front];
+
+        // Desenha um passo atrás da simulação, interpolando entre os dois
+        // últimos snapshots recebidos
+        double renderTime = GetWallTime() - SIM_TICK;
+        double span = current->time - previousSnapshot.time;
+        float alpha = span > 0.0 ? (renderTime - previousSnapshot.time) / span : 1.0f;
+        alpha = alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+
+        // Consumidores reagem aos eventos publicados pela simulação
+        ProcessEvents();
 
-        DrawGameGrid(selectedX, selectedY);
+        UpdateParticles(deltaTime);
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+
+        DrawGameGrid(current, &previousSnapshot, alpha);
 
         // Mostra a pontuação e o combo
-        DrawText(TextFormat("Score: %d", score), 10, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
-        DrawText(TextFormat("Combo: x%d", comboCount + 1), 200, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
-        DrawText(TextFormat("High: %d", highscore), (GetScreenWidth() - MeasureText(TextFormat("High: %d", highscore), 20)) - 10, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
+        DrawText(TextFormat("Score: %lld", (long long)current->score), 10, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
+        DrawText(TextFormat("Combo: x%d", current->comboCount + 1), 200, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
+        DrawText(TextFormat("High: %lld", (long long)current->highscore), (GetScreenWidth() - MeasureText(TextFormat("High: %lld", (long long)current->highscore), 20)) - 10, GRID_HEIGHT * CELL_SIZE + 10, 20, WHITE);
         DrawText(TextFormat("©PietroTy 2024"), 10, 10, 20, WHITE);
 
 
         EndDrawing();
+
+        if (isFirstFrame) {
+            step = BeginStartupStep(&startupProfile, "Primeiro frame");
+            EndStartupStep(&startupProfile, step);
+            PrintStartupProfile(&startupProfile);
+            isFirstFrame = false;
+        }
     }
 
 
 
+    __atomic_store_n(&isSimulationRunning, false, __ATOMIC_RELEASE);
+    pthread_join(simulationThread, NULL);
+    ProcessEvents();
+    SaveGame();
+
+    printf("Telemetria: %ld doces, %ld explosoes, %ld quedas, %ld novos doces, combo maximo x%d\n",
+           telemetry.matchedCells, telemetry.explosions, telemetry.drops, telemetry.spawns, telemetry.maxCombo + 1);
+
+    UnloadVoicePool(&popVoices);
     CloseAudioDevice();
     CloseWindow();
     return 0;
@@ -154,37 +373,39 @@ int main() {
 
 
 
-void InitializeGrid() {
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            grid[y][x].type = rand() % NUM_CANDY_TYPES;
-            grid[y][x].isMatched = false;
-            grid[y][x].isFallingOrSelected = false;
-            grid[y][x].fallingY = y * CELL_SIZE; // Posição inicial
-        }
+void InitFallAnimation() {
+    for (int i = 0; i < GRID_CELLS; i++) {
+        slotY[i] = (i / GRID_WIDTH) * CELL_SIZE;
+        dropPhase.candyY[i] = slotY[i]; // Posição inicial
+        dropPhase.candyVelY[i] = 0.0f;
     }
 }
 
 
-void DrawGameGrid(int selectedX, int selectedY) {
+void DrawGameGrid(const BoardSnapshot *current, const BoardSnapshot *previous, float alpha) {
     Color candyColorsOut[NUM_CANDY_TYPES] = {DARKRED, DARKGREEN, DARKBLUE, DARKYELLOW, DARKPURPLE};
     Color candyColorsIn[NUM_CANDY_TYPES] = {RED, GREEN, BLUE, YELLOW, PURPLE};
 
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
-            int type = grid[y][x].type;
+            int i = y * GRID_WIDTH + x;
+            int type = current->types[i];
 
             if (type == -1) continue;
 
+            // Interpola só se a mesma peça continuou caindo na célula
+            float drawY = current->candyY[i];
+            if (previous->types[i] == type && previous->candyY[i] < drawY) {
+                drawY = previous->candyY[i] + (drawY - previous->candyY[i]) * alpha;
+            }
+
             // Verificar se a célula é a selecionada ou está caindo
-            bool isSelectedOrFalling = (x == selectedX && y == selectedY) || grid[y][x].isFallingOrSelected;
+            bool isSelectedOrFalling = (x == current->selectedX && y == current->selectedY) || drawY < slotY[i];
 
             // Definir a largura e altura da célula (se está selecionada ou caindo)
             float width = isSelectedOrFalling ? SELECTED_SIZE : CELL_SIZE;
             float height = isSelectedOrFalling ? SELECTED_SIZE : CELL_SIZE;
 
-            float drawY = grid[y][x].fallingY;
-
             // Desenhar a célula (ajuste para animação)
             if (isSelectedOrFalling) { 
                 DrawRectangle(x * CELL_SIZE + (CELL_SIZE - SELECTED_SIZE) / 2, drawY + (CELL_SIZE - SELECTED_SIZE) / 2, width, height, candyColorsOut[type]);
@@ -196,190 +417,459 @@ void DrawGameGrid(int selectedX, int selectedY) {
 
         }
     }
+
+    // Mesmas primitivas dos doces: as partículas entram no mesmo lote de desenho
+    DrawParticles();
 }
 
-void TriggerExplosion(int centerX, int centerY) {
-    for (int y = centerY - EXPLOSION_RADIUS; y <= centerY + EXPLOSION_RADIUS; y++) {
-        for (int x = centerX - EXPLOSION_RADIUS; x <= centerX + EXPLOSION_RADIUS; x++) {
-            if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-                if (grid[y][x].type != -1) {
-                    grid[y][x].type = -1;
-                    score += 25 * (comboCount + 1); // Pontuação adicional
-                }
-            }
-        }
+// Emite partículas a partir do centro de uma célula; se o pool estiver cheio
+// as partículas excedentes são descartadas (sem alocação)
+void SpawnParticles(int cellX, int cellY, int amount, Color color, float size, float speed, float gravity, float life) {
+    for (int n = 0; n < amount && particles.count < MAX_PARTICLES; n++) {
+        int i = particles.count++;
+        particles.x[i] = cellX * CELL_SIZE + CELL_SIZE / 2.0f;
+        particles.y[i] = cellY * CELL_SIZE + CELL_SIZE / 2.0f;
+        particles.velX[i] = GetRandomValue(-100, 100) / 100.0f * speed;
+        particles.velY[i] = GetRandomValue(-100, 50) / 100.0f * speed;
+        particles.gravity[i] = gravity;
+        particles.life[i] = life;
+        particles.maxLife[i] = life;
+        particles.size[i] = size;
+        particles.color[i] = color;
     }
-    int startX = centerX - 2; // Posição inicial da explosão (5x5)
-    int startY = centerY - 2;
-    int endX = centerX + 2;
-    int endY = centerY + 2;
+}
 
-    for (int y = startY; y <= endY; y++) {
-        for (int x = startX; x <= endX; x++) {
-            if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
-                DrawRectangle(x * CELL_SIZE, y * CELL_SIZE, CELL_SIZE, CELL_SIZE, DARKORANGE);
-            }
+void UpdateParticles(float deltaTime) {
+    int count = particles.count;
+
+    // Integração sem desvios sobre os vetores (vetorizável)
+    for (int i = 0; i < count; i++) {
+        particles.velY[i] += particles.gravity[i] * deltaTime;
+        particles.x[i] += particles.velX[i] * deltaTime;
+        particles.y[i] += particles.velY[i] * deltaTime;
+        particles.life[i] -= deltaTime;
+    }
+
+    // Remove as partículas mortas trazendo a última para o lugar
+    for (int i = 0; i < count; ) {
+        if (particles.life[i] <= 0.0f) {
+            count--;
+            particles.x[i] = particles.x[count];
+            particles.y[i] = particles.y[count];
+            particles.velX[i] = particles.velX[count];
+            particles.velY[i] = particles.velY[count];
+            particles.gravity[i] = particles.gravity[count];
+            particles.life[i] = particles.life[count];
+            particles.maxLife[i] = particles.maxLife[count];
+            particles.size[i] = particles.size[count];
+            particles.color[i] = particles.color[count];
+        } else {
+            i++;
         }
     }
+
+    particles.count = count;
 }
 
-bool CheckMatches() {
-    bool foundMatch = false;
+void DrawParticles() {
+    for (int i = 0; i < particles.count; i++) {
+        float half = particles.size[i] / 2.0f;
+        Color color = Fade(particles.color[i], particles.life[i] / particles.maxLife[i]);
+        DrawRectangleV((Vector2){ particles.x[i] - half, particles.y[i] - half }, (Vector2){ particles.size[i], particles.size[i] }, color);
+    }
+}
 
-    // Verificar matches horizontais
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH - 2; x++) {
-            int type = grid[y][x].type;
-            int matchLength = 1;
+// Integra a queda de todas as peças a partir do deltaTime do frame.
+// Retorna true enquanto alguma peça ainda não chegou na sua célula.
+bool UpdateFallAnimation(float deltaTime) {
+    int anyFalling = 0; // Soma em int: um OU de bool impede a vetorização
+
+    // Laço sem desvios sobre os vetores empacotados (vetorizável); uma peça
+    // assenta quando alcança a posição de repouso da sua célula
+    for (int i = 0; i < GRID_CELLS; i++) {
+        float velY = dropPhase.candyVelY[i] + FALL_GRAVITY * deltaTime;
+        float posY = dropPhase.candyY[i] + velY * deltaTime;
+        bool landed = posY >= slotY[i];
+
+        dropPhase.candyY[i] = landed ? slotY[i] : posY;
+        dropPhase.candyVelY[i] = landed ? 0.0f : velY;
+        anyFalling += !landed;
+    }
 
-            if (type != -1) {
-                for (int k = 1; x + k < GRID_WIDTH && grid[y][x + k].type == type; k++) {
-                    matchLength++;
-                }
+    return anyFalling != 0;
+}
 
-                if (matchLength >= 3) {
-                    for (int k = 0; k < matchLength; k++) {
-                        grid[y][x + k].isMatched = true;
-                    }
-                    foundMatch = true;
 
-                    // Explosão para matches grandes
-                    if (matchLength >= 5) {
-                        TriggerExplosion(x + matchLength / 2, y);
-                    }
-                }
 
-                x += matchLength - 1; // Pula as peças já verificadas
-            }
-        }
+// A animação de queda da simulação reage ao evento na hora; depois ele é
+// publicado para os consumidores da thread de renderização
+void OnBoardEvent(const GameEvent *event, void *userData) {
+    AnimationHandleEvent(event);
+    PushEvent(&gameEvents, *event);
+}
+
+// O ícone vem direto do mapeamento; SetWindowIcon copia os pixels
+void LoadWindowIcon(const Pak *pak) {
+    const PakEntry *entry = FindPakEntry(pak, "iconeCandy");
+
+    if (entry != NULL && entry->kind == PAK_IMAGE) {
+        Image icon = { (void *)GetPakEntryData(pak, entry), entry->params[0], entry->params[1], entry->params[3], entry->params[2] };
+        SetWindowIcon(icon);
+    } else {
+#ifdef EMBED_RESOURCES
+        Image icon = LoadImageFromMemory(".png", iconeCandy_png, iconeCandy_png_size);
+#else
+        Image icon = LoadImage("resources/iconeCandy.png");
+#endif
+        SetWindowIcon(icon);
+        UnloadImage(icon);
     }
+}
 
-    // Verificar matches verticais
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = 0; y < GRID_HEIGHT - 2; y++) {
-            int type = grid[y][x].type;
-            int matchLength = 1;
+// As amostras PCM do arquivo mapeado são usadas sem decodificação nem cópia;
+// owned indica se a Wave precisa ser liberada com UnloadWave
+Wave DecodePopWave(const Pak *pak, bool *owned) {
+    const PakEntry *entry = FindPakEntry(pak, "Pop");
 
-            if (type != -1) {
-                for (int k = 1; y + k < GRID_HEIGHT && grid[y + k][x].type == type; k++) {
-                    matchLength++;
-                }
+    if (entry != NULL && entry->kind == PAK_WAVE) {
+        Wave wave = { entry->params[0], entry->params[1], entry->params[2], entry->params[3], (void *)GetPakEntryData(pak, entry) };
+        *owned = false;
+        return wave;
+    }
 
-                if (matchLength >= 3) {
-                    for (int k = 0; k < matchLength; k++) {
-                        grid[y + k][x].isMatched = true;
-                    }
-                    foundMatch = true;
+    *owned = true;
+#ifdef EMBED_RESOURCES
+    return LoadWaveFromMemory(".wav", Pop_wav, Pop_wav_size);
+#else
+    return LoadWave("resources/Pop.wav");
+#endif
+}
 
-                    // Explosão para matches grandes
-                    if (matchLength >= 5) {
-                        TriggerExplosion(x, y + matchLength / 2);
-                    }
-                }
+// Etapas da inicialização executadas em paralelo à criação da janela
+void *InitializeGridTask(void *arg) {
+    int step = BeginStartupStep(&startupProfile, "InitializeGrid");
+    InitializeBoard(&board, (uint64_t)time(NULL));
+    board.spawnQueues = &spawnQueues;
+    RefillSpawnQueues(&board);
+    InitUndoHistory(&undoHistory, undoBuffer, sizeof(undoBuffer));
+    InitFallAnimation();
+    LoadSavedGame();
+    board.onEvent = OnBoardEvent;
+    EndStartupStep(&startupProfile, step);
+    return NULL;
+}
 
-                y += matchLength - 1; // Pula as peças já verificadas
-            }
-        }
+void *InitAudioTask(void *arg) {
+    int step = BeginStartupStep(&startupProfile, "InitAudioDevice");
+    InitAudioDevice();
+    EndStartupStep(&startupProfile, step);
+    return NULL;
+}
+
+void *DecodePopTask(void *arg) {
+    int step = BeginStartupStep(&startupProfile, "DecodePopWave");
+    popWave = DecodePopWave((const Pak *)arg, &popWaveOwned);
+    EndStartupStep(&startupProfile, step);
+    return NULL;
+}
+
+void *LoadHighscoreTask(void *arg) {
+    int step = BeginStartupStep(&startupProfile, "LoadHighscore");
+    loadedHighscore = LoadHighscore();
+    EndStartupStep(&startupProfile, step);
+    return NULL;
+}
+
+void InitVoicePool(VoicePool *pool, Sound source) {
+    pool->source = source;
+    pool->next = 0;
+
+    for (int i = 0; i < POP_VOICES; i++) {
+        pool->voices[i] = LoadSoundAlias(source);
     }
+}
+
+// Toca a próxima voz com pitch e volume proporcionais ao combo
+void PlayPooledVoice(VoicePool *pool, int combo) {
+    Sound voice = pool->voices[pool->next];
+    pool->next = (pool->next + 1) % POP_VOICES;
+
+    float pitch = 1.0f + combo * POP_PITCH_STEP;
+    float volume = POP_BASE_VOLUME + combo * POP_VOLUME_STEP;
 
-    return foundMatch;
+    StopSound(voice); // Rouba a voz mais antiga
+    SetSoundPitch(voice, pitch < POP_MAX_PITCH ? pitch : POP_MAX_PITCH);
+    SetSoundVolume(voice, volume < 1.0f ? volume : 1.0f);
+    PlaySound(voice);
 }
 
-void ResolveMatches() {
-    bool matchResolved = false;
+void UnloadVoicePool(VoicePool *pool) {
+    for (int i = 0; i < POP_VOICES; i++) {
+        UnloadSoundAlias(pool->voices[i]);
+    }
 
-    for (int y = 0; y < GRID_HEIGHT; y++) {
-        for (int x = 0; x < GRID_WIDTH; x++) {
-            if (grid[y][x].isMatched) {
-                grid[y][x].type = -1; // Deixa a célula vazia
-                grid[y][x].isMatched = false;
+    UnloadSound(pool->source);
+}
 
-                // Aumenta a pontuação com base no combo atual
-                score += baseScore * (comboCount + 1);
-                matchResolved = true;
-            }
+// Áudio: um pop por resolução de matches, mais agudo a cada combo
+void AudioHandleEvents(const GameEvent *events, int count) {
+    for (int i = 0; i < count; i++) {
+        if (events[i].type == EVENT_MATCHES_RESOLVED) {
+            PlayPooledVoice(&popVoices, events[i].combo);
         }
     }
+}
+
+// Animação de queda (thread de simulação)
+void AnimationHandleEvent(const GameEvent *event) {
+    switch (event->type) {
+        case EVENT_CANDY_DROPPED: {
+            // A peça continua a animação de onde estava
+            int from = event->y * GRID_WIDTH + event->x;
+            int to = event->toY * GRID_WIDTH + event->x;
+            dropPhase.candyY[to] = dropPhase.candyY[from];
+            dropPhase.candyVelY[to] = dropPhase.candyVelY[from];
+            dropPhase.candyY[from] = slotY[from]; // Resetar a posição
+            dropPhase.candyVelY[from] = 0.0f;
+            break;
+        }
+
+        case EVENT_CANDY_SPAWNED: {
+            int i = event->y * GRID_WIDTH + event->x;
+            dropPhase.candyY[i] = (event->y - event->value) * CELL_SIZE; // Inicia fora da tela
+            dropPhase.candyVelY[i] = 0.0f;
+            break;
+        }
 
-    // Se ao menos uma combinação foi resolvida, aumente o comboCount
-    if (matchResolved) {
-        comboCount++;
+        default:
+            break;
     }
+}
+
+// Renderização: partículas
+void RenderHandleEvents(const GameEvent *events, int count) {
+    Color candyColors[NUM_CANDY_TYPES] = {RED, GREEN, BLUE, YELLOW, PURPLE};
 
-    if (score > highscore) {
-        highscore = score;
-        SaveHighscore(highscore);
+    for (int i = 0; i < count; i++) {
+        const GameEvent *event = &events[i];
+
+        switch (event->type) {
+            case EVENT_CELL_MATCHED:
+                SpawnParticles(event->x, event->y, POP_PARTICLES, candyColors[event->candy], 10.0f, 200.0f, PARTICLE_GRAVITY, 0.5f);
+                break;
+
+            case EVENT_EXPLOSION: {
+                // Clarão e estilhaços em cada célula da área da explosão
+                const uint64_t *area = explosionMasks[event->y * GRID_WIDTH + event->x];
+
+                for (int word = 0; word < MASK_WORDS; word++) {
+                    for (uint64_t bits = area[word]; bits != 0; bits &= bits - 1) {
+                        int cell = word * 64 + __builtin_ctzll(bits);
+                        SpawnParticles(cell % GRID_WIDTH, cell / GRID_WIDTH, 1, DARKORANGE, CELL_SIZE, 0.0f, 0.0f, 0.3f);
+                        SpawnParticles(cell % GRID_WIDTH, cell / GRID_WIDTH, EXPLOSION_PARTICLES, ORANGE, 8.0f, 300.0f, PARTICLE_GRAVITY, 0.6f);
+                    }
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
     }
 }
 
+// Persistência: salva apenas o último highscore do lote
+void PersistenceHandleEvents(const GameEvent *events, int count) {
+    int64_t newHighscore = -1;
 
-void SwapCandies(int x1, int y1, int x2, int y2) {
-    Candy temp = grid[y1][x1];
-    grid[y1][x1] = grid[y2][x2];
-    grid[y2][x2] = temp;
+    for (int i = 0; i < count; i++) {
+        if (events[i].type == EVENT_NEW_HIGHSCORE) {
+            newHighscore = events[i].value;
+        }
+    }
+
+    if (newHighscore != -1) {
+        SaveHighscore(newHighscore);
+    }
 }
 
-bool IsValidSwap(int x1, int y1, int x2, int y2) {
-    return (abs(x1 - x2) + abs(y1 - y2)) == 1;
+void TelemetryHandleEvents(const GameEvent *events, int count) {
+    for (int i = 0; i < count; i++) {
+        switch (events[i].type) {
+            case EVENT_CELL_MATCHED: telemetry.matchedCells++; break;
+            case EVENT_EXPLOSION: telemetry.explosions++; break;
+            case EVENT_CANDY_DROPPED: telemetry.drops++; break;
+            case EVENT_CANDY_SPAWNED: telemetry.spawns++; break;
+            case EVENT_COMBO_CHANGED:
+                if (events[i].combo > telemetry.maxCombo) {
+                    telemetry.maxCombo = events[i].combo;
+                }
+                break;
+            default:
+                break;
+        }
+    }
 }
 
-void DropCandies(float deltaTime) {
-    bool isDropped = false;
+// Esvazia a fila em lotes e entrega cada lote a todos os consumidores
+void ProcessEvents() {
+    static GameEvent batch[EVENT_QUEUE_CAPACITY];
+    int count;
 
-    for (int x = 0; x < GRID_WIDTH; x++) {
-        for (int y = GRID_HEIGHT - 1; y >= 0; y--) {
-            if (grid[y][x].type == -1) {
-                for (int k = y - 1; k >= 0; k--) {
-                    if (grid[k][x].type != -1) {
-                        // Transferir a peça
-                        grid[y][x].type = grid[k][x].type;
-                        grid[y][x].fallingY = grid[k][x].fallingY;
-                        grid[y][x].isFallingOrSelected = true;
+    while ((count = PopEvents(&gameEvents, batch, EVENT_QUEUE_CAPACITY)) > 0) {
+        AudioHandleEvents(batch, count);
+        RenderHandleEvents(batch, count);
+        PersistenceHandleEvents(batch, count);
+        TelemetryHandleEvents(batch, count);
+    }
+}
 
-                        grid[k][x].type = -1;
-                        grid[k][x].fallingY = k * CELL_SIZE; // Resetar a posição
-                        isDropped = true;
-                        break;
-                    }
+// Clique do jogador: seleciona a peça ou tenta a troca com a selecionada
+void HandleClick(int gridX, int gridY) {
+    if (gridX >= 0 && gridX < GRID_WIDTH && gridY >= 0 && gridY < GRID_HEIGHT) {
+        if (selectedX == -1 && selectedY == -1) {
+            selectedX = gridX;
+            selectedY = gridY;
+        } else if (!isMoveOpen && IsBoardSettled()) {
+            // Uma troca por vez e só com o tabuleiro parado, para que o
+            // ponto de partida da jogada no histórico seja sempre estável
+            BeginUndoMove(&board, &moveStart);
+            isMoveOpen = TrySwap(&board, selectedX, selectedY, gridX, gridY);
+            selectedX = -1;
+            selectedY = -1;
+        }
+    }
+}
+
+// Aplica um comando do jogador. Desfazer e refazer só valem com o
+// tabuleiro parado, no mesmo estado em que a jogada foi gravada
+void HandleInput(const InputEvent *input) {
+    switch (input->type) {
+        case INPUT_CLICK:
+            HandleClick(input->gridX, input->gridY);
+            break;
+        case INPUT_UNDO:
+        case INPUT_REDO:
+            if (!isMoveOpen && IsBoardSettled()) {
+                if (input->type == INPUT_UNDO) {
+                    UndoMove(&undoHistory, &board);
+                } else {
+                    RedoMove(&undoHistory, &board);
                 }
+                selectedX = -1;
+                selectedY = -1;
             }
+            break;
+    }
+}
 
-            // Se a peça estiver animando, atualizar posição em incrementos de CELL_SIZE
-            if (grid[y][x].fallingY < y * CELL_SIZE) {
-                grid[y][x].fallingY += CELL_SIZE; // Incrementar de forma discreta
-                if (grid[y][x].fallingY >= y * CELL_SIZE) {
-                    grid[y][x].fallingY = y * CELL_SIZE; // Corrigir posição
-                    grid[y][x].isFallingOrSelected = false;
-                }
-                isDropped = true;
+// Sem queda em andamento, sem buracos e sem matches pendentes
+bool IsBoardSettled() {
+    if (dropPhase.isDropping) {
+        return false;
+    }
+
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            if (board.grid[y][x].type == -1 || board.grid[y][x].isMatched) {
+                return false;
             }
         }
     }
 
-    if (!isDropped) {
-        // Após completar a queda, garantir que todas as peças paradas não estejam marcadas como caindo
-        for (int y = 0; y < GRID_HEIGHT; y++) {
-            for (int x = 0; x < GRID_WIDTH; x++) {
-                grid[y][x].isFallingOrSelected = false;
-            }
+    // Doces que acabaram de cair ainda podem formar um match que o próximo
+    // passo vai resolver
+    MatchGroups matches;
+    return FindMatchGroups(&board, &matches) == 0;
+}
+
+// Um passo fixo das regras e da animação de queda
+void SimulationStep(float deltaTime) {
+    InputEvent inputs[INPUT_QUEUE_CAPACITY];
+    int inputCount = PopInputs(&inputQueue, inputs, INPUT_QUEUE_CAPACITY);
+
+    // Comandos durante a queda são descartados
+    for (int i = 0; i < inputCount; i++) {
+        if (!dropPhase.isDropping) {
+            HandleInput(&inputs[i]);
         }
+    }
 
-        GenerateNewCandies();
+    // Matches automáticos - combos consecutivos
+    if (CheckMatches(&board)) {
+        ResolveMatches(&board);
+    } else if (!dropPhase.isDropping) {
+        // Reseta o combo quando não houver mais matches automáticos
+        SetComboCount(&board, 0);
     }
 
-    isDropping = isDropped;
+    dropPhase.dropTimer += deltaTime;
+    if (dropPhase.dropTimer >= FALL_SPEED) {
+        dropPhase.isDropping = DropCandies(&board);
+        dropPhase.dropTimer = 0.0f;
+    }
+
+    // A animação avança a cada passo, independente do timer da lógica
+    if (UpdateFallAnimation(deltaTime)) {
+        dropPhase.isDropping = true;
+    }
+
+    // A jogada termina quando a cascata inteira acabou
+    if (isMoveOpen && IsBoardSettled()) {
+        CommitUndoMove(&undoHistory, &moveStart, &board);
+        isMoveOpen = false;
+    }
 }
 
+// Roda as regras em passo fixo e publica um snapshot a cada passo, sem
+// esperar pela renderização
+void *SimulationThread(void *arg) {
+    double nextTick = GetWallTime();
+
+    while (__atomic_load_n(&isSimulationRunning, __ATOMIC_ACQUIRE)) {
+        SimulationStep(SIM_TICK);
+        PublishSnapshot(GetWallTime());
+
+        nextTick += SIM_TICK;
+        double now = GetWallTime();
+        if (nextTick > now) {
+            WaitTime(nextTick - now);
+        } else if (now - nextTick > 0.25) {
+            nextTick = now; // Muito atrasada: não tenta recuperar os passos perdidos
+        }
+    }
 
+    return NULL;
+}
+
+// Copia o estado da simulação para o slot de escrita e o troca com o pronto
+void PublishSnapshot(double time) {
+    BoardSnapshot *snapshot = &snapshots.slots[snapshots.back];
 
-void GenerateNewCandies() {
     for (int y = 0; y < GRID_HEIGHT; y++) {
         for (int x = 0; x < GRID_WIDTH; x++) {
-            if (grid[y][x].type == -1) {
-                grid[y][x].type = rand() % NUM_CANDY_TYPES;
-                grid[y][x].fallingY = -CELL_SIZE; // Inicia fora da tela
-                grid[y][x].isFallingOrSelected = true;
-            }
+            snapshot->types[y * GRID_WIDTH + x] = board.grid[y][x].type;
         }
     }
-}
\ No newline at end of file
+    memcpy(snapshot->candyY, dropPhase.candyY, sizeof(dropPhase.candyY));
+    snapshot->score = board.score;
+    snapshot->highscore = board.highscore;
+    snapshot->comboCount = board.comboCount;
+    snapshot->selectedX = selectedX;
+    snapshot->selectedY = selectedY;
+    snapshot->time = time;
+
+    int previous = __atomic_exchange_n(&snapshots.ready, snapshots.back | SNAPSHOT_FRESH, __ATOMIC_ACQ_REL);
+    snapshots.back = previous & ~SNAPSHOT_FRESH;
+}
+
+// Pega o snapshot mais recente, se houver um novo; front passa a apontar para ele
+bool AcquireSnapshot() {
+    if (!(__atomic_load_n(&snapshots.ready, __ATOMIC_ACQUIRE) & SNAPSHOT_FRESH)) {
+        return false;
+    }
+
+    int previous = __atomic_exchange_n(&snapshots.ready, snapshots.front, __ATOMIC_ACQ_REL);
+    snapshots.front = previous & ~SNAPSHOT_FRESH;
+    return true;
+}
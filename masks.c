@@ -0,0 +1,213 @@
+// Gerado por tools/masks.c - nao editar
+
+#include "masks.h"
+
+#if GRID_WIDTH != 10 || GRID_HEIGHT != 10 || EXPLOSION_RADIUS != 2 || NUM_CANDY_TYPES != 5
+#error "masks.c desatualizado: rode make masks"
+#endif
+
+const uint64_t explosionMasks[GRID_CELLS][MASK_WORDS] = {
+    { 0x0000000000701c07ull, 0x0000000000000000ull },
+    { 0x0000000000f03c0full, 0x0000000000000000ull },
+    { 0x0000000001f07c1full, 0x0000000000000000ull },
+    { 0x0000000003e0f83eull, 0x0000000000000000ull },
+    { 0x0000000007c1f07cull, 0x0000000000000000ull },
+    { 0x000000000f83e0f8ull, 0x0000000000000000ull },
+    { 0x000000001f07c1f0ull, 0x0000000000000000ull },
+    { 0x000000003e0f83e0ull, 0x0000000000000000ull },
+    { 0x000000003c0f03c0ull, 0x0000000000000000ull },
+    { 0x00000000380e0380ull, 0x0000000000000000ull },
+    { 0x00000001c0701c07ull, 0x0000000000000000ull },
+    { 0x00000003c0f03c0full, 0x0000000000000000ull },
+    { 0x00000007c1f07c1full, 0x0000000000000000ull },
+    { 0x0000000f83e0f83eull, 0x0000000000000000ull },
+    { 0x0000001f07c1f07cull, 0x0000000000000000ull },
+    { 0x0000003e0f83e0f8ull, 0x0000000000000000ull },
+    { 0x0000007c1f07c1f0ull, 0x0000000000000000ull },
+    { 0x000000f83e0f83e0ull, 0x0000000000000000ull },
+    { 0x000000f03c0f03c0ull, 0x0000000000000000ull },
+    { 0x000000e0380e0380ull, 0x0000000000000000ull },
+    { 0x00000701c0701c07ull, 0x0000000000000000ull },
+    { 0x00000f03c0f03c0full, 0x0000000000000000ull },
+    { 0x00001f07c1f07c1full, 0x0000000000000000ull },
+    { 0x00003e0f83e0f83eull, 0x0000000000000000ull },
+    { 0x00007c1f07c1f07cull, 0x0000000000000000ull },
+    { 0x0000f83e0f83e0f8ull, 0x0000000000000000ull },
+    { 0x0001f07c1f07c1f0ull, 0x0000000000000000ull },
+    { 0x0003e0f83e0f83e0ull, 0x0000000000000000ull },
+    { 0x0003c0f03c0f03c0ull, 0x0000000000000000ull },
+    { 0x000380e0380e0380ull, 0x0000000000000000ull },
+    { 0x001c0701c0701c00ull, 0x0000000000000000ull },
+    { 0x003c0f03c0f03c00ull, 0x0000000000000000ull },
+    { 0x007c1f07c1f07c00ull, 0x0000000000000000ull },
+    { 0x00f83e0f83e0f800ull, 0x0000000000000000ull },
+    { 0x01f07c1f07c1f000ull, 0x0000000000000000ull },
+    { 0x03e0f83e0f83e000ull, 0x0000000000000000ull },
+    { 0x07c1f07c1f07c000ull, 0x0000000000000000ull },
+    { 0x0f83e0f83e0f8000ull, 0x0000000000000000ull },
+    { 0x0f03c0f03c0f0000ull, 0x0000000000000000ull },
+    { 0x0e0380e0380e0000ull, 0x0000000000000000ull },
+    { 0x701c0701c0700000ull, 0x0000000000000000ull },
+    { 0xf03c0f03c0f00000ull, 0x0000000000000000ull },
+    { 0xf07c1f07c1f00000ull, 0x0000000000000001ull },
+    { 0xe0f83e0f83e00000ull, 0x0000000000000003ull },
+    { 0xc1f07c1f07c00000ull, 0x0000000000000007ull },
+    { 0x83e0f83e0f800000ull, 0x000000000000000full },
+    { 0x07c1f07c1f000000ull, 0x000000000000001full },
+    { 0x0f83e0f83e000000ull, 0x000000000000003eull },
+    { 0x0f03c0f03c000000ull, 0x000000000000003cull },
+    { 0x0e0380e038000000ull, 0x0000000000000038ull },
+    { 0x701c0701c0000000ull, 0x00000000000001c0ull },
+    { 0xf03c0f03c0000000ull, 0x00000000000003c0ull },
+    { 0xf07c1f07c0000000ull, 0x00000000000007c1ull },
+    { 0xe0f83e0f80000000ull, 0x0000000000000f83ull },
+    { 0xc1f07c1f00000000ull, 0x0000000000001f07ull },
+    { 0x83e0f83e00000000ull, 0x0000000000003e0full },
+    { 0x07c1f07c00000000ull, 0x0000000000007c1full },
+    { 0x0f83e0f800000000ull, 0x000000000000f83eull },
+    { 0x0f03c0f000000000ull, 0x000000000000f03cull },
+    { 0x0e0380e000000000ull, 0x000000000000e038ull },
+    { 0x701c070000000000ull, 0x00000000000701c0ull },
+    { 0xf03c0f0000000000ull, 0x00000000000f03c0ull },
+    { 0xf07c1f0000000000ull, 0x00000000001f07c1ull },
+    { 0xe0f83e0000000000ull, 0x00000000003e0f83ull },
+    { 0xc1f07c0000000000ull, 0x00000000007c1f07ull },
+    { 0x83e0f80000000000ull, 0x0000000000f83e0full },
+    { 0x07c1f00000000000ull, 0x0000000001f07c1full },
+    { 0x0f83e00000000000ull, 0x0000000003e0f83eull },
+    { 0x0f03c00000000000ull, 0x0000000003c0f03cull },
+    { 0x0e03800000000000ull, 0x000000000380e038ull },
+    { 0x701c000000000000ull, 0x000000001c0701c0ull },
+    { 0xf03c000000000000ull, 0x000000003c0f03c0ull },
+    { 0xf07c000000000000ull, 0x000000007c1f07c1ull },
+    { 0xe0f8000000000000ull, 0x00000000f83e0f83ull },
+    { 0xc1f0000000000000ull, 0x00000001f07c1f07ull },
+    { 0x83e0000000000000ull, 0x00000003e0f83e0full },
+    { 0x07c0000000000000ull, 0x00000007c1f07c1full },
+    { 0x0f80000000000000ull, 0x0000000f83e0f83eull },
+    { 0x0f00000000000000ull, 0x0000000f03c0f03cull },
+    { 0x0e00000000000000ull, 0x0000000e0380e038ull },
+    { 0x7000000000000000ull, 0x000000001c0701c0ull },
+    { 0xf000000000000000ull, 0x000000003c0f03c0ull },
+    { 0xf000000000000000ull, 0x000000007c1f07c1ull },
+    { 0xe000000000000000ull, 0x00000000f83e0f83ull },
+    { 0xc000000000000000ull, 0x00000001f07c1f07ull },
+    { 0x8000000000000000ull, 0x00000003e0f83e0full },
+    { 0x0000000000000000ull, 0x00000007c1f07c1full },
+    { 0x0000000000000000ull, 0x0000000f83e0f83eull },
+    { 0x0000000000000000ull, 0x0000000f03c0f03cull },
+    { 0x0000000000000000ull, 0x0000000e0380e038ull },
+    { 0x0000000000000000ull, 0x000000001c0701c0ull },
+    { 0x0000000000000000ull, 0x000000003c0f03c0ull },
+    { 0x0000000000000000ull, 0x000000007c1f07c0ull },
+    { 0x0000000000000000ull, 0x00000000f83e0f80ull },
+    { 0x0000000000000000ull, 0x00000001f07c1f00ull },
+    { 0x0000000000000000ull, 0x00000003e0f83e00ull },
+    { 0x0000000000000000ull, 0x00000007c1f07c00ull },
+    { 0x0000000000000000ull, 0x0000000f83e0f800ull },
+    { 0x0000000000000000ull, 0x0000000f03c0f000ull },
+    { 0x0000000000000000ull, 0x0000000e0380e000ull },
+};
+
+const uint64_t zobristKeys[GRID_CELLS][NUM_CANDY_TYPES] = {
+    { 0xfecf9d2fd4388952ull, 0x8f2b14c6ed493218ull, 0x0adbfb2713b178f3ull, 0x6e26cfca3e963c9bull, 0xa3c1e0d45d13532bull, },
+    { 0x26335731c8a312a0ull, 0x2e564e4869d6e847ull, 0xc98e46202d49fb8aull, 0x5fc0982f09920b6bull, 0xec0913fd1c1fb59aull, },
+    { 0xe9216140440c4cefull, 0x08fb6fbd99db266aull, 0xf5b92fa4b455d437ull, 0x05aba6223d5d3701ull, 0xcb1649b289b04c0dull, },
+    { 0xead0db373237c44full, 0x23228ea4d61c5837ull, 0x9fba0004e3c6f235ull, 0x3dc919661ead67caull, 0xb8abc2ad33c33467ull, },
+    { 0xece079eb819a2988ull, 0xb91b7f63a2d97ea6ull, 0x1812f64b715d0e59ull, 0x3d8cff02e78a078bull, 0x52b19620c107ae2eull, },
+    { 0xe23f3d105e99ff2full, 0x2e007cd9d821ce6eull, 0x949f632b2896d8cbull, 0x6fcc41c938ff0ee1ull, 0x5688f62e1495505full, },
+    { 0xeab1f1b4e30a1547ull, 0x1fba9d007c8f0692ull, 0xce179299aab88c20ull, 0xd6f5134f70799d20ull, 0x296507a55a4595a7ull, },
+    { 0xb18ad63457784f56ull, 0xaa08cec225e012eeull, 0xba2bcd826828d917ull, 0xa06e54fa475bb40eull, 0xd9fe4f54a223e417ull, },
+    { 0x0e350eadb9a0f5b8ull, 0xd4be373a2d65491full, 0x090951b8a70a6e2cull, 0x0cc43e2c0b0270e0ull, 0x0d19d8059f5097c8ull, },
+    { 0x8eeb5ff5239cd757ull, 0xf915545b7f83a3d6ull, 0xd3ab031a6714e9c4ull, 0x86577e834eddf66bull, 0xd1f0b9ea65cc5855ull, },
+    { 0x38edc5ba906ad504ull, 0x13727746d87dbc0dull, 0xc6111d7e787aef17ull, 0xbc7c39a295ffae33ull, 0xe1e51459c73e0a8aull, },
+    { 0x8f7fcc8fa766ebeaull, 0xe998c10449cc0746ull, 0xa7cbba24c0f9d587ull, 0xc91e9313687cc73aull, 0xb19a8d851c24c421ull, },
+    { 0x86f4f5b8119b0f72ull, 0x72b5d2559f122ae8ull, 0x4efb911fc239082bull, 0xaa0e15a4cd77e7e2ull, 0xa48d3b99a8c6d66bull, },
+    { 0x3c0997db9baad53eull, 0x1e0c309bdcb6b814ull, 0x84bb09a9a70c84a9ull, 0x50b96ba136506827ull, 0x6ca52d14feef5251ull, },
+    { 0xf1b648d46fe1173dull, 0xa8e028b4509f2b39ull, 0xc24ff81b54384ab2ull, 0x91b11c119782c421ull, 0xee6612aa7d63e31aull, },
+    { 0xf72a1b40931e35e4ull, 0xc41db4defeccbdc6ull, 0x7d8bf43f9f295d29ull, 0xe70ea843e8f2f47cull, 0x3cd1e08a6269fcadull, },
+    { 0x710c021a714ee3d6ull, 0x0c4d94181618167aull, 0x322538313387d3c8ull, 0xe52ae670a3b2b151ull, 0xacad51cc347859c2ull, },
+    { 0x8699d7c8c095f065ull, 0x4e17c9e5c662e58aull, 0x860e0d076a616372ull, 0xa6c9196fdddc38eeull, 0x3dcf8f00f089af67ull, },
+    { 0xb3058df008d64b30ull, 0x1d581858bd177ebdull, 0x11017b7df337edc4ull, 0xea5ee9e6aca79111ull, 0x9905b79659614922ull, },
+    { 0x6b47db29cba7eb26ull, 0xb6e3e86750374933ull, 0xed5491c715105d8dull, 0xa9434e76927dfbc8ull, 0xea6f2a6c5319178full, },
+    { 0xb09463bdfd52fdcbull, 0x864c7999c4f2f28dull, 0xb13cdd0f3a780abbull, 0xe4a0511d6202353aull, 0xdd1fc5995a28dbceull, },
+    { 0x177cbbd9f96bc556ull, 0x05cec89b87a3fc76ull, 0xd13282655452601aull, 0x73748f6cf6fcecb2ull, 0xc6c1eefe472cef12ull, },
+    { 0x5fcbfae5cc953f1bull, 0x2cb39f85dcde0483ull, 0x31f08badd187bc20ull, 0x2643881a6a431de1ull, 0xb8e67913ec667546ull, },
+    { 0x52702b7e6889eed4ull, 0x8f8b126178d1f6b7ull, 0x5d158e6d5f46f506ull, 0xa860a728f00d52c6ull, 0x14a491d830496395ull, },
+    { 0x92101f9600b64aa6ull, 0x46d467abaf21b9e1ull, 0xd23d8ad8fd11445dull, 0xcfc8d6a8a28961e3ull, 0x678e5539d73be4d9ull, },
+    { 0x14ec0d98e57bdeb4ull, 0xc1d7adb392c1590aull, 0x141e23ade36e5911ull, 0x0512f0c6c942d4b5ull, 0xfde27b36e396e240ull, },
+    { 0xf69a325b87ed84b9ull, 0x1bcb0f5f22987798ull, 0x1a0a4241f2ffaac1ull, 0x976e25b343a884baull, 0xd74e0e55a5bf859dull, },
+    { 0x65e9a3d2fe806a2bull, 0x7559444110231771ull, 0x82c781a387360bf2ull, 0xef5f8e9da43f6be6ull, 0x661151123f8a9365ull, },
+    { 0xfce2d94f9e860725ull, 0x68c02b0b7c67c962ull, 0xc1a8068a2d95e91eull, 0x29fbd058b9ae8893ull, 0x46d9a9f6c12f7927ull, },
+    { 0x88f4eebeab48901bull, 0xf3d571f8d5bbc6e6ull, 0xf43e7f22565247f2ull, 0x80648cca8b57e052ull, 0xade18934b9f05df1ull, },
+    { 0xe376f3d2a4964bfcull, 0x0192207117322b94ull, 0xd828a75478818b0dull, 0xc32a1c867e0669d1ull, 0x05b58f1eed1bc5e4ull, },
+    { 0x86061eee1a644401ull, 0x0ad912df2ebae5dfull, 0x75004946b5c2e34full, 0x6b2d0d272168a9b7ull, 0x1aaa6ccc41db2a32ull, },
+    { 0x3f2ff617df55f5cbull, 0x5828617bf62e447bull, 0x0a7a1aee3b03b0c2ull, 0x7dc1838dbf2c0a2aull, 0x891e21306aa4782full, },
+    { 0x63941561293a3507ull, 0x91c89dfa1fc49255ull, 0xda563df978ced9baull, 0xd5a1a552398ba11bull, 0x263bbdf6719ac949ull, },
+    { 0x690b06b23a5c9d8bull, 0x3c44f10acc25d5ccull, 0x1242ffc65b08e924ull, 0x1bb0d5c2a8ff3d7dull, 0x0e8a15cbad8f1454ull, },
+    { 0x1cc179063b127e5full, 0xa7739bef88d291dfull, 0x14075ddb1c6dd8bfull, 0xc909625293a52b98ull, 0xdd4bca4584bcfffeull, },
+    { 0x0ec4b5bbd7aef4ecull, 0x0ffbb1542942b5c7ull, 0x0e802d017c314ab2ull, 0xe160031cd4209a43ull, 0xc2d34c942291bab8ull, },
+    { 0x2f90b3e41287827dull, 0x0987e73faed3eb94ull, 0x8bd03db09a3fe42cull, 0x3978a7695a4d4874ull, 0xd2066b3070addfc4ull, },
+    { 0xb209ae8443363379ull, 0x6b5b182d7dc024bdull, 0xe24bcb0fd8bd3d3bull, 0x5a09af54ec8bf3f5ull, 0x24693e9177db9cb9ull, },
+    { 0x721abd2bfde2b36eull, 0x577c8089c522e213ull, 0x8dab504a02589339ull, 0xabbd0ad855a131dfull, 0x2f6bfc5aab0c26e5ull, },
+    { 0x1b01585134bf1bcaull, 0x0918569cfb0c99a2ull, 0x287dd9c1428b42c5ull, 0xc279098d52236db3ull, 0xce4d6df041bedef8ull, },
+    { 0xb2a1b414448bd42aull, 0x98f8c889270e5ca9ull, 0x2174c5782564d01dull, 0xdbb600a530cc2aceull, 0x71845a0b6a284d9bull, },
+    { 0xb57b45630d0155bbull, 0x8196bac37d681e22ull, 0x5256947674cb27b2ull, 0x7347d72e401533d2ull, 0xdb21dd1cfcf193caull, },
+    { 0x35f38b83efedd4c2ull, 0xfcdc0759673f720full, 0x976697f5442b418dull, 0xc3b255781e6b76e4ull, 0xd5878f32ea6d7ebfull, },
+    { 0xaf9903609badd53cull, 0xdb57873b718aac05ull, 0x41f71320e22b372cull, 0xa7aed12d6b78e489ull, 0x50753322ba646a03ull, },
+    { 0xd710455ef5ec7117ull, 0x96b0e2675f7d5c24ull, 0x75e778e7a3480851ull, 0x68137f4ba31f79e3ull, 0xb0a9bcb3160bf7d2ull, },
+    { 0x18c0a7e3843e42cfull, 0x81c1e497c1bce99aull, 0x51ccaf8e69244f4aull, 0x1e838ee081aa72fbull, 0x74280e56cd8bc56aull, },
+    { 0xc7ed27e9af573a2aull, 0xb2ca93d98b8de62cull, 0xf569b2a83addb996ull, 0xa2f75539d8f2c711ull, 0x8116d5043784eb5full, },
+    { 0xaef8c6b2dfceddf5ull, 0x36879c505c038b63ull, 0x9cb8d3c29ce5cd9bull, 0x083b64f17983904bull, 0x4e8d43b3dd9f0f70ull, },
+    { 0xb5bcff0ed1250cc3ull, 0x06ec7afcc75746efull, 0xc51011ce68eee46eull, 0x0785e6bb225592beull, 0x4c841a76132093f1ull, },
+    { 0x77398684f2408d75ull, 0x40e7e24ce722133eull, 0xbc2d0feb08d34dd8ull, 0xadc90186706ff596ull, 0xa2a750a2654d295aull, },
+    { 0xccb2d9db260b3b53ull, 0x083a51df898d1ddfull, 0x2d049462319d7220ull, 0x4a75c4e728e9cac0ull, 0xe4aeba9fa47cfa0full, },
+    { 0xc6dd0595d8c3fcc2ull, 0xcb936f9cf9caf333ull, 0x0ec1645bb9f4d28dull, 0x1ade383b2eccf2f7ull, 0xec273c5d053013b5ull, },
+    { 0xa16a50a8e825e5b1ull, 0xaf8e81563a2ee3ceull, 0xb3bdbcf4a06b3ef0ull, 0xb77a9b1545aa8027ull, 0x3bf3e65b301e9a2dull, },
+    { 0x83fa35a738e97b06ull, 0x58f50aa752c53a17ull, 0xcda934998cb068d4ull, 0xa4df4e39b8449552ull, 0x6011a39eede65910ull, },
+    { 0x3b1f1f9e50f82342ull, 0x2e6de4c2d2e25d05ull, 0x20c166409cd6e192ull, 0x6c22e7b3a10afc3bull, 0xca9d183b6686b398ull, },
+    { 0xb58b492b358ef0c6ull, 0xd06b286cee4e9fd9ull, 0xc9e917d69a7d2711ull, 0x00994d733615ce7aull, 0xf5efa74445dbe30bull, },
+    { 0x3298212d93e71232ull, 0xb21a119d4414fbbbull, 0xec8f566e6d476f92ull, 0x0fcb5c89d52a88b7ull, 0xb61e01e92b9bc8c2ull, },
+    { 0xa15e60ada034edbeull, 0x2c92ba1fcbe3ae3eull, 0x3bb0a0cb18462c83ull, 0x6757fdbcfd4596ecull, 0x9953843d04f56509ull, },
+    { 0x8ad7b6651444fcfcull, 0x66fb2dc0dd001751ull, 0xb0fe7338ddb2f2cbull, 0x1b5bfea60eabbdfdull, 0x5afe118b79c7b969ull, },
+    { 0xb4fa3f7dc906847aull, 0x0b526d63dffc7940ull, 0xe18b0193e2491ee6ull, 0x39cc9d2c638e818dull, 0xc746156e59db800cull, },
+    { 0x0844ccd6468c1a6aull, 0x935fe28df40c5260ull, 0xd28bbac27dc14173ull, 0xe00de9f6c5fe2149ull, 0x360ffbe2d5c105f1ull, },
+    { 0xb154f578685cff89ull, 0x7da9a6da6943d503ull, 0x97ca5b2d1687ffe6ull, 0xa2b8273f4160ec66ull, 0x6c1c3acbc8840d0dull, },
+    { 0x1a5d8fa198e4db0dull, 0x789f432180478398ull, 0x45d5533807fc7231ull, 0x0be218da30b8f089ull, 0x8d0adcda4c427ab7ull, },
+    { 0xb3fd5cf52810342bull, 0xb8824907d30517e0ull, 0x4f0a5948dccf27a2ull, 0xa0534a19506661d4ull, 0x2de031284d81257bull, },
+    { 0x0d2442db618ababdull, 0x460228659a2ab616ull, 0x2c2ca769c47a00bdull, 0xef6621bab0bbb1faull, 0x7a4cd27dd71b628cull, },
+    { 0xb51d05d1d862a674ull, 0xf1571de34a766425ull, 0xfd101c50574fba04ull, 0x088b53828a8af9a0ull, 0x5093373ae100d0a0ull, },
+    { 0xf0312e8cddabcf26ull, 0xedf5430801b07ee9ull, 0xb5ea56b6507e1a29ull, 0x8c2023bfc45fab15ull, 0x951d5ac8003eb750ull, },
+    { 0x49529de2d9506b2bull, 0x755ac90abea623a7ull, 0x022f6ce062a2458eull, 0xb1f6d607abdeedd9ull, 0x4685b5dbd8dab44eull, },
+    { 0x1552b89021e2a508ull, 0x623b4a70a8d646d1ull, 0xccfc5228f4f37967ull, 0x2a4811d7c4582123ull, 0x21147efb93b8698eull, },
+    { 0x05c26befb14fc48dull, 0x8125b86175622d2aull, 0x766e28c7882648e6ull, 0x2e34450a9299448full, 0x4c71c325829bc0a1ull, },
+    { 0x35daabc9f92dd816ull, 0x95f71b15de89a269ull, 0xa76358997de1cc5aull, 0x8cc5d6346d46920bull, 0xf50117cbbdd9ed30ull, },
+    { 0xe71931047c3b8617ull, 0xc277d8d57e4a5887ull, 0xf589cb4174586a02ull, 0x82bed6f7de3ededeull, 0xcd62ea084e506587ull, },
+    { 0xbfd3233503d0569aull, 0xf0a182fb4325988dull, 0xbed4d154cf006312ull, 0xd908356c9f55d427ull, 0xaf25a260fb39131cull, },
+    { 0x761a7b3c977b439cull, 0x1bae31b8babae75aull, 0xa616bd53a8f6c958ull, 0xcbfb12a55dbe183full, 0x736244fbdfa32cd8ull, },
+    { 0xcaad4b7bedc19bf9ull, 0xbd13adeba03a1080ull, 0x880e4d3a7e633e4dull, 0x0e6dba2c57cc4999ull, 0x2760ff19723c757aull, },
+    { 0x4634efcacbcf22aeull, 0xbf60fd5cf80acf0eull, 0x19825045ad917d2aull, 0x83a801a13cd714daull, 0x3147896d76388500ull, },
+    { 0xb40710d402e91ba7ull, 0xcb9ace4d512f1433ull, 0xa7f7828f077cb937ull, 0x3bc8c20535858208ull, 0x2b1ce91dcb9a807full, },
+    { 0x1d743f40641e6d10ull, 0x66fd926cfa82b7c0ull, 0xad9b813cc62b1b88ull, 0xa69f502fd07b727dull, 0xb63e63a1ed7f5bd6ull, },
+    { 0xa1d99199d0a43e20ull, 0x8a0d4727d72999f2ull, 0x3b0f30edcac0cfdeull, 0xf8e917a416f5e937ull, 0xadbb4acc026df730ull, },
+    { 0x60d8122a25174ce0ull, 0x7b8d9036d0d9fe46ull, 0x77e77a6eaa4b2ccdull, 0x8edb2ee15a47d6d9ull, 0x9244d4378c21de0bull, },
+    { 0x29fe987e5023d72full, 0x98fcf0f062cc4e6cull, 0x1c820244e948640bull, 0x98c9c69fcf98ee37ull, 0xb41fe7a1f74e3d0bull, },
+    { 0x6df71bf81578c7e0ull, 0x6f4a6845f7847eb9ull, 0x8b9922c263791a20ull, 0x4f483a855e8edf44ull, 0xb14b6ecc3feaf90full, },
+    { 0x1bf7e5a14fced084ull, 0x016fe14985945b77ull, 0x453fa2b6edeec317ull, 0xe15922d73ce8de8bull, 0xa2edbf1a1ef08175ull, },
+    { 0x851f5d785b8fe0bfull, 0xa96be10d19dce3dcull, 0xd356940c89d54898ull, 0xef190c31ece5fea0ull, 0x6269bb1826bc9f3cull, },
+    { 0xa7e6d0bf63b60313ull, 0x747a3e283755468cull, 0x3b18c2cacfeddcd1ull, 0x2c0e43318886fd0bull, 0x0f90abbcb63a0201ull, },
+    { 0x6816d19bf52ad733ull, 0x1c942f5057a5b2abull, 0x7727f1a4d6087c71ull, 0x04dfc5cce1c1a67aull, 0x528541e32da3df03ull, },
+    { 0xc5f8910c530a222eull, 0x0dad6ffb3d25aef0ull, 0xd6a1515a123cd328ull, 0x30fae835a751d83dull, 0xffe86221eb6b5c1dull, },
+    { 0x97a481a8a9290072ull, 0x27bc48ab9734797eull, 0x21034799e384ab37ull, 0x8b2bf55f602f80d1ull, 0x428e53ed31c6b163ull, },
+    { 0x62a79c662ccafafdull, 0xbc1b6504d59e0729ull, 0xcbf1d14300694237ull, 0xab9989edbb64a3cfull, 0xe54d5bf2d19f7ad0ull, },
+    { 0x737023e035762f22ull, 0x87c8aeaf1d2fdb66ull, 0xdee575fe8dec03e4ull, 0x13bd2f2b5208abbeull, 0x70e2091a391a7648ull, },
+    { 0xbf5de59045170f73ull, 0xe2a9529e5a35a74full, 0x7f401d014f519b55ull, 0xa68eea18235c8afbull, 0xf7060809148ff191ull, },
+    { 0xd962b7e7fbd0bdebull, 0xfdaf7bfe71636201ull, 0x780473fc515f2740ull, 0x395174cfcd5214a9ull, 0x6b48dc6e6ed29bd0ull, },
+    { 0x66524160cdd50a7dull, 0xa1a5d3c5850eb636ull, 0xf497e037d058ec5dull, 0x1afa96f7efc4d18dull, 0xcaf9bd3b3dc824abull, },
+    { 0x26811357bf81a653ull, 0x6273bd9e7e707253ull, 0x52f5289c19acfaa1ull, 0x3b3745a10cd3d3abull, 0xb17f5a3298d371d3ull, },
+    { 0x94343ea65a9f363cull, 0x6a89f094fef4d2e9ull, 0x35d8343910b175a7ull, 0x3d8d8c8b949e3cbaull, 0xc8e51e697e0d7225ull, },
+    { 0x44a2c23442514894ull, 0x6f089462e7d0fab5ull, 0xa4f4036ef0e046cbull, 0xd153db6e473dfbb8ull, 0xe12e489ecb47f577ull, },
+    { 0x8e5a5ea4def12decull, 0x7f3d3fe163c43166ull, 0x73e5a37fe5cb5b50ull, 0xfe46b28e41501b20ull, 0xf150c7090d6c5309ull, },
+    { 0xd0ebd812977294b8ull, 0xd5069f95db59f36bull, 0xfaa44334e5383f59ull, 0x33d7c26047e94eefull, 0x14faf16a1b7c3f20ull, },
+    { 0xd0818ea8b7ec3f90ull, 0xe2efb54a6f3fcbeaull, 0x80659649cef81419ull, 0xee0d5935ab75a639ull, 0x42c981a3444f2142ull, },
+};
@@ -0,0 +1,20 @@
+#ifndef MASKS_H
+#define MASKS_H
+
+#include <stdint.h>
+#include "candy.h"
+
+// Tabelas pré-calculadas, geradas por tools/masks.c em masks.c. As máscaras
+// de células usam bit = y * GRID_WIDTH + x, em duas palavras de 64 bits
+#define MASK_WORDS 2
+
+// Área da explosão (quadrado de raio EXPLOSION_RADIUS) em volta de cada
+// célula, já cortada nas bordas
+extern const uint64_t explosionMasks[GRID_CELLS][MASK_WORDS];
+
+// Chaves Zobrist: uma por célula e tipo (células vazias não entram no hash)
+extern const uint64_t zobristKeys[GRID_CELLS][NUM_CANDY_TYPES];
+
+typedef char GridFitsInMask[GRID_CELLS <= 64 * MASK_WORDS ? 1 : -1];
+
+#endif
@@ -0,0 +1,80 @@
+#include "packed.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Os caminhos SSE2 leem a grade como bytes {type, isMatched}
+typedef char CandyIsTwoBytes[sizeof(Candy) == 2 ? 1 : -1];
+
+void PackGrid(const Board *board, unsigned char *out) {
+    const Candy *cells = &board->grid[0][0];
+    int i = 0;
+
+#ifdef __SSE2__
+    // 16 células (32 bytes) viram 8 bytes por iteração
+    const __m128i lowByte = _mm_set1_epi16(0x00FF);
+    const __m128i one = _mm_set1_epi8(1);
+
+    for (; i + 16 <= GRID_CELLS; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(cells + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(cells + i + 8));
+
+        // Só os tipos (bytes pares), já somados de 1
+        __m128i types = _mm_add_epi8(_mm_packus_epi16(_mm_and_si128(a, lowByte), _mm_and_si128(b, lowByte)), one);
+
+        // Junta cada par de bytes em um: par no nibble baixo, ímpar no alto
+        __m128i pairs = _mm_or_si128(_mm_and_si128(types, lowByte), _mm_slli_epi16(_mm_srli_epi16(types, 8), 4));
+        _mm_storel_epi64((__m128i *)(out + i / 2), _mm_packus_epi16(pairs, pairs));
+    }
+#endif
+
+    for (; i < GRID_CELLS; i += 2) {
+        unsigned char low = (unsigned char)(cells[i].type + 1);
+        unsigned char high = i + 1 < GRID_CELLS ? (unsigned char)(cells[i + 1].type + 1) : 0;
+        out[i / 2] = low | (high << 4);
+    }
+}
+
+// Restaura os tipos; isMatched fica false e os buracos por coluna e o hash
+// são recalculados. Um nibble acima do último tipo recusa a grade inteira,
+// sem alterar o tabuleiro
+bool UnpackGrid(Board *board, const unsigned char *in) {
+    Candy *cells = &board->grid[0][0];
+    int i = 0;
+
+    for (int byte = 0; byte < PACKED_GRID_SIZE; byte++) {
+        if ((in[byte] & 0x0F) > NUM_CANDY_TYPES || (in[byte] >> 4) > NUM_CANDY_TYPES) {
+            return false;
+        }
+    }
+
+#ifdef __SSE2__
+    const __m128i lowNibble = _mm_set1_epi8(0x0F);
+    const __m128i one = _mm_set1_epi8(1);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16 <= GRID_CELLS; i += 16) {
+        __m128i packed = _mm_loadl_epi64((const __m128i *)(in + i / 2));
+
+        // Intercala nibble baixo e alto: 16 tipos em ordem
+        __m128i low = _mm_and_si128(packed, lowNibble);
+        __m128i high = _mm_and_si128(_mm_srli_epi16(packed, 4), lowNibble);
+        __m128i types = _mm_sub_epi8(_mm_unpacklo_epi8(low, high), one);
+
+        // {type, isMatched = 0} para cada célula
+        _mm_storeu_si128((__m128i *)(cells + i), _mm_unpacklo_epi8(types, zero));
+        _mm_storeu_si128((__m128i *)(cells + i + 8), _mm_unpackhi_epi8(types, zero));
+    }
+#endif
+
+    for (; i < GRID_CELLS; i++) {
+        unsigned char nibble = i % 2 == 0 ? in[i / 2] & 0x0F : in[i / 2] >> 4;
+        cells[i].type = (signed char)(nibble - 1);
+        cells[i].isMatched = false;
+    }
+
+    CountColumnHoles(board);
+    board->hash = ComputeBoardHash(board);
+    return true;
+}
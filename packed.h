@@ -0,0 +1,16 @@
+#ifndef PACKED_H
+#define PACKED_H
+
+#include "candy.h"
+
+// Grade compactada em 4 bits por célula: tipo + 1 (0 = vazia), duas células
+// por byte, a de índice par no nibble baixo. É a forma usada para guardar e
+// transmitir tabuleiros
+#define PACKED_GRID_SIZE ((GRID_CELLS + 1) / 2)
+
+void PackGrid(const Board *board, unsigned char *out);
+bool UnpackGrid(Board *board, const unsigned char *in);
+
+typedef char CandyTypeFitsInNibble[NUM_CANDY_TYPES < 16 ? 1 : -1];
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pak.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Mapeia o arquivo inteiro somente para leitura
+static const unsigned char *MapFile(const char *fileName, size_t *size) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = NULL;
+    void *base = NULL;
+
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    if (mapping != NULL) {
+        base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping); // A view continua válida
+    }
+    CloseHandle(file);
+
+    *size = base != NULL ? (size_t)fileSize.QuadPart : 0;
+    return base;
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    void *base = MAP_FAILED;
+
+    if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd); // O mapeamento continua válido
+
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (size_t)info.st_size;
+    return base;
+#endif
+}
+
+static void UnmapFile(const unsigned char *base, size_t size) {
+#ifdef _WIN32
+    (void)size;
+    UnmapViewOfFile(base);
+#else
+    munmap((void *)base, size);
+#endif
+}
+
+bool OpenPak(const char *fileName, Pak *pak) {
+    memset(pak, 0, sizeof(*pak));
+
+    size_t size = 0;
+    const unsigned char *base = MapFile(fileName, &size);
+    if (base == NULL) {
+        return false;
+    }
+
+    const PakHeader *header = (const PakHeader *)base;
+    bool valid = size >= sizeof(PakHeader) &&
+                 memcmp(header->magic, PAK_MAGIC, 4) == 0 &&
+                 header->version == PAK_VERSION &&
+                 header->entryCount <= (size - sizeof(PakHeader)) / sizeof(PakEntry);
+
+    // Confere se todos os recursos estão dentro do arquivo
+    const PakEntry *entries = (const PakEntry *)(base + sizeof(PakHeader));
+    for (uint32_t i = 0; valid && i < header->entryCount; i++) {
+        valid = entries[i].offset <= size && entries[i].size <= size - entries[i].offset;
+    }
+
+    if (!valid) {
+        UnmapFile(base, size);
+        return false;
+    }
+
+    pak->base = base;
+    pak->size = size;
+    pak->header = header;
+    pak->entries = entries;
+    return true;
+}
+
+const PakEntry *FindPakEntry(const Pak *pak, const char *name) {
+    if (pak->base == NULL) {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < pak->header->entryCount; i++) {
+        if (strncmp(pak->entries[i].name, name, PAK_NAME_SIZE) == 0) {
+            return &pak->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+const void *GetPakEntryData(const Pak *pak, const PakEntry *entry) {
+    return pak->base + entry->offset;
+}
+
+void ClosePak(Pak *pak) {
+    if (pak->base != NULL) {
+        UnmapFile(pak->base, pak->size);
+    }
+
+    memset(pak, 0, sizeof(*pak));
+}
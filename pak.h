@@ -0,0 +1,51 @@
+#ifndef PAK_H
+#define PAK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PAK_FILE "resources/candyboom.pak"
+#define PAK_MAGIC "CBPK"
+#define PAK_VERSION 1
+#define PAK_NAME_SIZE 32
+#define PAK_ALIGNMENT 16 // Alinhamento dos dados de cada recurso
+
+// Tipos de recurso no arquivo; os dados já estão decodificados
+typedef enum {
+    PAK_IMAGE = 1, // params: width, height, format (PixelFormat), mipmaps
+    PAK_WAVE = 2,  // params: frameCount, sampleRate, sampleSize, channels
+    PAK_RAW = 3    // Bytes sem conversão
+} PakEntryKind;
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+} PakHeader;
+
+typedef struct {
+    char name[PAK_NAME_SIZE];
+    uint32_t kind;
+    uint32_t offset; // A partir do início do arquivo
+    uint32_t size;
+    uint32_t params[4];
+    uint32_t reserved;
+} PakEntry;
+
+// Arquivo de recursos mapeado em memória; os ponteiros apontam direto
+// para o mapeamento e valem até ClosePak
+typedef struct {
+    const unsigned char *base;
+    size_t size;
+    const PakHeader *header;
+    const PakEntry *entries;
+} Pak;
+
+bool OpenPak(const char *fileName, Pak *pak);
+const PakEntry *FindPakEntry(const Pak *pak, const char *name);
+const void *GetPakEntryData(const Pak *pak, const PakEntry *entry);
+void ClosePak(Pak *pak);
+
+#endif
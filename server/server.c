@@ -0,0 +1,580 @@
+// Servidor headless do Candyboom: hospeda muitos tabuleiros independentes em
+// um único processo e atende clientes por um socket Unix local. Usa as regras
+// de candy.c, sem raylib.
+//
+// usage: candyboom-server [caminho do socket]
+//
+// Protocolo (uma linha por comando, resposta em uma linha):
+//    NEW [seed]                -> OK <id>
+//    SWAP <id> <x1> <y1> <x2> <y2>
+//                              -> OK <passos> <eliminados> <explosoes> <score> <tabuleiro>
+//                                 ou INVALID <score> <tabuleiro>
+//    BOARD <id>                -> OK <score> <combo> <tabuleiro>
+//    EVENTS <id>               -> OK <n> <tipo:x:y:combo:valor>... (eventos recentes)
+//    SAVE <id>                 -> OK <snapshot em hexadecimal>
+//    LOAD <id> <hex>           -> OK <score> <combo> <tabuleiro>
+//    UNDO <id> / REDO <id>     -> OK <score> <tabuleiro> ou ERR se não houver jogada
+//    FREE <id>                 -> OK
+//    HINT <id> [simulações]    -> OK <x1> <y1> <x2> <y2> <pontos esperados> ou OK NONE
+//    PLAN <id> [ms]            -> como HINT, com busca em árvore (MCTS) dentro do tempo dado
+//    STATS                     -> OK <sessões> <bytes reservados>
+// O tabuleiro vai linha por linha, um dígito por célula ('.' = vazia).
+// As sessões pertencem à conexão que as criou e somem quando ela fecha.
+// HINT e PLAN rodam numa thread própria sobre uma cópia do tabuleiro: os
+// outros clientes continuam sendo atendidos, e os comandos seguintes do
+// mesmo cliente esperam a resposta para manter a ordem.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "bot.h"
+#include "session.h"
+#include "snapshot.h"
+
+#define DEFAULT_SOCKET_PATH "/tmp/candyboom.sock"
+#define MAX_CLIENTS 1024
+#define CLIENT_BUFFER_SIZE 4096
+#define HINT_ROLLOUTS 64
+#define HINT_MAX_ROLLOUTS 256
+#define HINT_DEPTH 2
+#define PLAN_MILLISECONDS 20
+#define PLAN_MAX_MILLISECONDS 200 // As buscas rodam uma por vez: limita a espera na fila
+#define PLAN_HORIZON 2
+#define PLAN_NODES (1 << 18) // 8 MB de nós, reservados na partida
+#define BOT_TABLE_BYTES (4 << 20) // Pontos de jogadas já resolvidas, comum ao HINT e ao PLAN
+
+typedef struct {
+    int fd;
+    char input[CLIENT_BUFFER_SIZE];
+    int inputLength;
+    char output[CLIENT_BUFFER_SIZE];
+    int outputLength;
+    int firstSession; // Sessões do cliente (id, -1 = nenhuma)
+    bool isWaitingBot; // HINT/PLAN em andamento; o slot só é reusado depois dele
+} Client;
+
+// Pedido de HINT/PLAN, no máximo um por cliente. O tabuleiro vai copiado,
+// então a sessão pode mudar ou sumir enquanto a busca roda
+typedef struct {
+    bool isPlan;
+    Board board;
+    BotSettings hint;
+    MctsSettings plan;
+    int bestMove; // Resultado, preenchido pela thread do bot
+    double bestScore;
+} BotJob;
+
+// Fila de índices de clientes; cada cliente está em no máximo uma
+typedef struct {
+    int items[MAX_CLIENTS];
+    int head;
+    int count;
+} ClientQueue;
+
+Client clients[MAX_CLIENTS];
+struct pollfd pollFds[MAX_CLIENTS + 2]; // Escuta, clientes e o aviso da thread do bot
+
+SessionStore sessions;
+WorkerPool botPool; // Threads das simulações do HINT e do PLAN
+MctsSearch planSearch;
+TranspositionTable botTable;
+
+BotJob botJobs[MAX_CLIENTS];
+ClientQueue pendingJobs; // As duas filas são protegidas por botLock
+ClientQueue finishedJobs;
+pthread_mutex_t botLock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t botWork = PTHREAD_COND_INITIALIZER;
+int botWakeFds[2]; // A thread do bot escreve um byte a cada busca pronta
+
+void PushClient(ClientQueue *queue, int clientIndex) {
+    queue->items[(queue->head + queue->count++) % MAX_CLIENTS] = clientIndex;
+}
+
+int PopClient(ClientQueue *queue) {
+    int clientIndex = queue->items[queue->head];
+    queue->head = (queue->head + 1) % MAX_CLIENTS;
+    queue->count--;
+    return clientIndex;
+}
+
+// Roda as buscas uma de cada vez, cada uma com todas as threads do pool
+void *BotThread(void *arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&botLock);
+    for (;;) {
+        while (pendingJobs.count == 0) {
+            pthread_cond_wait(&botWork, &botLock);
+        }
+        int clientIndex = PopClient(&pendingJobs);
+        pthread_mutex_unlock(&botLock);
+
+        BotJob *job = &botJobs[clientIndex];
+        BotDecision decision;
+        if (job->isPlan) {
+            SearchMovesMcts(&planSearch, &job->board, &job->plan, &botPool, &botTable, &decision);
+        } else {
+            EvaluateMovesMonteCarlo(&job->board, &job->hint, &botPool, &botTable, &decision);
+        }
+        job->bestMove = decision.bestMove;
+        job->bestScore = decision.bestScore;
+
+        pthread_mutex_lock(&botLock);
+        PushClient(&finishedJobs, clientIndex);
+        char wake = 0;
+        while (write(botWakeFds[1], &wake, 1) < 0 && errno == EINTR) {
+        }
+    }
+    return NULL;
+}
+
+// Entrega o pedido em botJobs[clientIndex] à thread do bot; as próximas
+// linhas do cliente ficam no buffer até a resposta
+void StartBotJob(int clientIndex) {
+    clients[clientIndex].isWaitingBot = true;
+
+    pthread_mutex_lock(&botLock);
+    PushClient(&pendingJobs, clientIndex);
+    pthread_cond_signal(&botWork);
+    pthread_mutex_unlock(&botLock);
+}
+
+// Mantém a lista de sessões de cada cliente para fechá-las em O(sessões dele)
+void LinkSession(Session *session, int clientIndex) {
+    Client *client = &clients[clientIndex];
+
+    session->nextOwned = client->firstSession;
+    if (client->firstSession != -1) {
+        FindSession(&sessions, client->firstSession)->prevOwned = session->id;
+    }
+    client->firstSession = session->id;
+}
+
+void UnlinkSession(Session *session) {
+    if (session->prevOwned != -1) {
+        FindSession(&sessions, session->prevOwned)->nextOwned = session->nextOwned;
+    } else {
+        clients[session->owner].firstSession = session->nextOwned;
+    }
+
+    if (session->nextOwned != -1) {
+        FindSession(&sessions, session->nextOwned)->prevOwned = session->prevOwned;
+    }
+}
+
+Session *FindOwnedSession(int id, int clientIndex) {
+    Session *session = FindSession(&sessions, id);
+    return session != NULL && session->owner == clientIndex ? session : NULL;
+}
+
+void Reply(Client *client, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    int available = CLIENT_BUFFER_SIZE - client->outputLength;
+    int written = vsnprintf(client->output + client->outputLength, available, format, args);
+    va_end(args);
+
+    // Sem espaço: a resposta é descartada e o cliente será desconectado
+    client->outputLength += written < available ? written : available;
+}
+
+void FormatBoard(const Board *board, char *out) {
+    for (int y = 0; y < GRID_HEIGHT; y++) {
+        for (int x = 0; x < GRID_WIDTH; x++) {
+            int type = board->grid[y][x].type;
+            *out++ = type == -1 ? '.' : (char)('0' + type);
+        }
+    }
+    *out = '\0';
+}
+
+// Valor de um dígito hexadecimal, ou -1
+int HexDigit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// Converte exatamente 2 * size dígitos, sem espaços nem nada depois.
+// Retorna false se houver outro caractere
+bool DecodeHex(const char *hex, unsigned char *out, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        int high = HexDigit(hex[2 * i]);
+        int low = HexDigit(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        out[i] = (unsigned char)(high << 4 | low);
+    }
+    return true;
+}
+
+void ReplyDecision(Client *client, const BotJob *job) {
+    int x1, y1, x2, y2;
+
+    if (job->bestMove == BOT_NO_MOVE) {
+        Reply(client, "OK NONE\n");
+        return;
+    }
+    DecodeMove(job->bestMove, &x1, &y1, &x2, &y2);
+    Reply(client, "OK %d %d %d %d %.1f\n", x1, y1, x2, y2, job->bestScore);
+}
+
+void HandleCommand(int clientIndex, char *line) {
+    Client *client = &clients[clientIndex];
+    char boardText[GRID_CELLS + 1];
+    char command[16];
+    int id, x1, y1, x2, y2;
+    unsigned long long seed;
+
+    if (sscanf(line, "%15s", command) != 1) {
+        return;
+    }
+
+    // Comandos sobre uma sessão existente do próprio cliente
+    bool needsSession = strcmp(command, "SWAP") == 0 || strcmp(command, "BOARD") == 0 ||
+                        strcmp(command, "EVENTS") == 0 || strcmp(command, "FREE") == 0 ||
+                        strcmp(command, "SAVE") == 0 || strcmp(command, "LOAD") == 0 ||
+                        strcmp(command, "UNDO") == 0 || strcmp(command, "REDO") == 0 ||
+                        strcmp(command, "HINT") == 0 || strcmp(command, "PLAN") == 0;
+    Session *session = NULL;
+    if (needsSession) {
+        if (sscanf(line, "%*s %d", &id) != 1 || (session = FindOwnedSession(id, clientIndex)) == NULL) {
+            Reply(client, "ERR sessao invalida\n");
+            return;
+        }
+    }
+
+    if (strcmp(command, "NEW") == 0) {
+        if (sscanf(line, "%*s %llu", &seed) != 1) {
+            seed = (unsigned long long)time(NULL) ^ ((unsigned long long)sessions.count << 32);
+        }
+
+        session = CreateSession(&sessions, clientIndex, seed);
+        if (session == NULL) {
+            Reply(client, "ERR sem memoria\n");
+        } else {
+            LinkSession(session, clientIndex);
+            Reply(client, "OK %d\n", session->id);
+        }
+    } else if (strcmp(command, "SWAP") == 0) {
+        Board *board = &session->board;
+        if (sscanf(line, "%*s %d %d %d %d %d", &id, &x1, &y1, &x2, &y2) != 5) {
+            Reply(client, "ERR argumentos invalidos\n");
+            return;
+        }
+
+        bool inside = x1 >= 0 && x1 < GRID_WIDTH && y1 >= 0 && y1 < GRID_HEIGHT &&
+                      x2 >= 0 && x2 < GRID_WIDTH && y2 >= 0 && y2 < GRID_HEIGHT;
+        session->clearedCells = 0;
+        session->explosions = 0;
+
+        UndoCheckpoint checkpoint;
+        BeginUndoMove(board, &checkpoint);
+        CascadeTrace trace;
+        if (inside && ResolveAll(board, x1, y1, x2, y2, &trace)) {
+            UndoHistory *undo = GetSessionUndo(&sessions, session);
+            if (undo != NULL) {
+                CommitUndoMove(undo, &checkpoint, board);
+            }
+            FormatBoard(board, boardText);
+            Reply(client, "OK %d %d %d %lld %s\n", trace.stepCount, session->clearedCells, session->explosions, (long long)board->score, boardText);
+        } else {
+            FormatBoard(board, boardText);
+            Reply(client, "INVALID %lld %s\n", (long long)board->score, boardText);
+        }
+    } else if (strcmp(command, "BOARD") == 0) {
+        FormatBoard(&session->board, boardText);
+        Reply(client, "OK %lld %d %s\n", (long long)session->board.score, session->board.comboCount, boardText);
+    } else if (strcmp(command, "EVENTS") == 0) {
+        unsigned int first = session->eventTotal > SESSION_EVENT_CAPACITY ? session->eventTotal - SESSION_EVENT_CAPACITY : 0;
+
+        Reply(client, "OK %u", session->eventTotal - first);
+        for (unsigned int i = first; i < session->eventTotal; i++) {
+            const GameEvent *event = &session->events[i % SESSION_EVENT_CAPACITY];
+            Reply(client, " %d:%d:%d:%d:%lld", event->type, event->x, event->y, event->combo, (long long)event->value);
+        }
+        Reply(client, "\n");
+    } else if (strcmp(command, "SAVE") == 0) {
+        unsigned char snapshot[SNAPSHOT_MAX_SIZE];
+        size_t size = SaveSnapshot(&session->board, NULL, snapshot, sizeof(snapshot));
+
+        Reply(client, "OK ");
+        for (size_t i = 0; i < size; i++) {
+            Reply(client, "%02x", snapshot[i]);
+        }
+        Reply(client, "\n");
+    } else if (strcmp(command, "LOAD") == 0) {
+        unsigned char snapshot[SNAPSHOT_MAX_SIZE];
+        int hexStart = 0;
+
+        sscanf(line, "%*s %*d %n", &hexStart);
+        if (hexStart == 0) {
+            Reply(client, "ERR argumentos invalidos\n");
+            return;
+        }
+        const char *hex = line + hexStart;
+        size_t length = strlen(hex);
+        size_t size = length / 2;
+        if (length % 2 != 0 || size > sizeof(snapshot) || !DecodeHex(hex, snapshot, size)) {
+            Reply(client, "ERR snapshot invalido\n");
+            return;
+        }
+
+        // Restaura só o estado: a sessão mantém seu próprio handler de eventos
+        if (!LoadSnapshot(&session->board, NULL, snapshot, size)) {
+            Reply(client, "ERR snapshot invalido\n");
+            return;
+        }
+        if (session->undo != NULL) {
+            ClearUndoHistory(session->undo);
+        }
+        FormatBoard(&session->board, boardText);
+        Reply(client, "OK %lld %d %s\n", (long long)session->board.score, session->board.comboCount, boardText);
+    } else if (strcmp(command, "UNDO") == 0 || strcmp(command, "REDO") == 0) {
+        bool applied = session->undo != NULL &&
+                       (strcmp(command, "UNDO") == 0 ? UndoMove(session->undo, &session->board)
+                                                     : RedoMove(session->undo, &session->board));
+        if (!applied) {
+            Reply(client, "ERR nada para %s\n", strcmp(command, "UNDO") == 0 ? "desfazer" : "refazer");
+            return;
+        }
+        FormatBoard(&session->board, boardText);
+        Reply(client, "OK %lld %s\n", (long long)session->board.score, boardText);
+    } else if (strcmp(command, "HINT") == 0) {
+        int rollouts;
+        if (sscanf(line, "%*s %*d %d", &rollouts) != 1 || rollouts <= 0) {
+            rollouts = HINT_ROLLOUTS;
+        }
+
+        BotJob *job = &botJobs[clientIndex];
+        job->isPlan = false;
+        job->board = session->board;
+        job->hint = (BotSettings){ rollouts < HINT_MAX_ROLLOUTS ? rollouts : HINT_MAX_ROLLOUTS, HINT_DEPTH, false,
+                                   session->board.spawnSeed ^ (uint64_t)session->board.score };
+        StartBotJob(clientIndex);
+    } else if (strcmp(command, "PLAN") == 0) {
+        int milliseconds;
+        if (sscanf(line, "%*s %*d %d", &milliseconds) != 1 || milliseconds <= 0) {
+            milliseconds = PLAN_MILLISECONDS;
+        }
+
+        BotJob *job = &botJobs[clientIndex];
+        job->isPlan = true;
+        job->board = session->board;
+        job->plan = (MctsSettings){ (milliseconds < PLAN_MAX_MILLISECONDS ? milliseconds : PLAN_MAX_MILLISECONDS) / 1000.0,
+                                    PLAN_HORIZON, false, session->board.spawnSeed ^ (uint64_t)session->board.score };
+        StartBotJob(clientIndex);
+    } else if (strcmp(command, "FREE") == 0) {
+        UnlinkSession(session);
+        DestroySession(&sessions, session);
+        Reply(client, "OK\n");
+    } else if (strcmp(command, "STATS") == 0) {
+        Reply(client, "OK %d %zu\n", sessions.count, GetSessionStoreBytes(&sessions));
+    } else {
+        Reply(client, "ERR comando desconhecido\n");
+    }
+}
+
+void CloseClient(int clientIndex) {
+    while (clients[clientIndex].firstSession != -1) {
+        Session *session = FindSession(&sessions, clients[clientIndex].firstSession);
+        UnlinkSession(session);
+        DestroySession(&sessions, session);
+    }
+
+    close(clients[clientIndex].fd);
+    clients[clientIndex].fd = -1;
+    pollFds[clientIndex + 1].fd = -1;
+}
+
+// Executa as linhas completas já recebidas, parando num HINT/PLAN até a
+// resposta dele
+void ProcessInput(int clientIndex) {
+    Client *client = &clients[clientIndex];
+    char *line = client->input;
+    char *end;
+
+    while (!client->isWaitingBot && (end = strchr(line, '\n')) != NULL) {
+        *end = '\0';
+        HandleCommand(clientIndex, line);
+        line = end + 1;
+    }
+
+    client->inputLength -= (int)(line - client->input);
+    memmove(client->input, line, client->inputLength + 1);
+}
+
+// Lê o que chegou, executa cada linha completa e tenta enviar as respostas.
+// Retorna false se o cliente deve ser desconectado
+bool ServiceClient(int clientIndex, short revents) {
+    Client *client = &clients[clientIndex];
+
+    // Com o buffer cheio de linhas esperando o bot, a leitura fica para depois
+    if ((revents & (POLLIN | POLLHUP | POLLERR)) && client->inputLength < CLIENT_BUFFER_SIZE - 1) {
+        ssize_t received = read(client->fd, client->input + client->inputLength, CLIENT_BUFFER_SIZE - 1 - client->inputLength);
+        if (received <= 0) {
+            return received < 0 && errno == EINTR;
+        }
+        client->inputLength += (int)received;
+        client->input[client->inputLength] = '\0';
+
+        ProcessInput(clientIndex);
+        if (client->inputLength == CLIENT_BUFFER_SIZE - 1 && strchr(client->input, '\n') == NULL) {
+            return false; // Linha longa demais
+        }
+    }
+
+    if (client->outputLength > 0) {
+        if (client->outputLength == CLIENT_BUFFER_SIZE) {
+            return false; // Cliente não está lendo as respostas
+        }
+
+        ssize_t sent = send(client->fd, client->output, client->outputLength, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+        client->outputLength -= (int)sent;
+        memmove(client->output, client->output + sent, client->outputLength);
+    }
+
+    return true;
+}
+
+// Responde os clientes cujas buscas terminaram e retoma as linhas que
+// ficaram no buffer
+void FinishBotJobs(void) {
+    char wake[64];
+    while (read(botWakeFds[0], wake, sizeof(wake)) > 0) {
+    }
+
+    // Copia a fila antes: ProcessInput pode pedir outra busca
+    ClientQueue finished;
+    pthread_mutex_lock(&botLock);
+    finished = finishedJobs;
+    finishedJobs.count = 0;
+    pthread_mutex_unlock(&botLock);
+
+    while (finished.count > 0) {
+        int clientIndex = PopClient(&finished);
+        clients[clientIndex].isWaitingBot = false;
+        if (clients[clientIndex].fd != -1) {
+            ReplyDecision(&clients[clientIndex], &botJobs[clientIndex]);
+            ProcessInput(clientIndex);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *socketPath = argc > 1 ? argv[1] : DEFAULT_SOCKET_PATH;
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socketPath, sizeof(address.sun_path) - 1);
+    unlink(socketPath);
+
+    if (bind(listener, (struct sockaddr *)&address, sizeof(address)) < 0 || listen(listener, 128) < 0) {
+        perror("bind/listen");
+        return 1;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    InitSessionStore(&sessions);
+    InitWorkerPool(&botPool, 0);
+    if (!InitMctsSearch(&planSearch, PLAN_NODES) || !InitTranspositionTable(&botTable, BOT_TABLE_BYTES)) {
+        perror("malloc");
+        return 1;
+    }
+
+    pthread_t botThread;
+    if (pipe(botWakeFds) < 0 || fcntl(botWakeFds[0], F_SETFL, O_NONBLOCK) < 0 ||
+        pthread_create(&botThread, NULL, BotThread, NULL) != 0) {
+        perror("pipe/pthread_create");
+        return 1;
+    }
+    printf("Candyboom server em %s\n", socketPath);
+
+    pollFds[0].fd = listener;
+    pollFds[0].events = POLLIN;
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        clients[i].fd = -1;
+        pollFds[i + 1].fd = -1;
+    }
+    pollFds[MAX_CLIENTS + 1].fd = botWakeFds[0];
+    pollFds[MAX_CLIENTS + 1].events = POLLIN;
+
+    for (;;) {
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            pollFds[i + 1].events = (clients[i].inputLength < CLIENT_BUFFER_SIZE - 1 ? POLLIN : 0) |
+                                    (clients[i].outputLength > 0 ? POLLOUT : 0);
+        }
+
+        if (poll(pollFds, MAX_CLIENTS + 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("poll");
+            return 1;
+        }
+
+        if (pollFds[0].revents & POLLIN) {
+            int fd = accept(listener, NULL, NULL);
+            int slot = -1;
+            for (int i = 0; fd >= 0 && i < MAX_CLIENTS && slot == -1; i++) {
+                if (clients[i].fd == -1 && !clients[i].isWaitingBot) {
+                    slot = i;
+                }
+            }
+
+            if (slot == -1) {
+                if (fd >= 0) {
+                    close(fd); // Servidor cheio
+                }
+            } else {
+                clients[slot].fd = fd;
+                clients[slot].inputLength = 0;
+                clients[slot].outputLength = 0;
+                clients[slot].firstSession = -1;
+                pollFds[slot + 1].fd = fd;
+            }
+        }
+
+        if (pollFds[MAX_CLIENTS + 1].revents & POLLIN) {
+            FinishBotJobs();
+        }
+
+        for (int i = 0; i < MAX_CLIENTS; i++) {
+            if (clients[i].fd != -1 && pollFds[i + 1].revents != 0) {
+                if (!ServiceClient(i, pollFds[i + 1].revents)) {
+                    CloseClient(i);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include "session.h"
+
+#include <stdlib.h>
+
+// Guarda só os eventos de resumo no buffer da sessão; os eventos por célula
+// viram contadores
+static void OnSessionEvent(const GameEvent *event, void *userData) {
+    Session *session = userData;
+
+    switch (event->type) {
+        case EVENT_CELL_MATCHED:
+            session->clearedCells++;
+            return;
+        case EVENT_CANDY_DROPPED:
+        case EVENT_CANDY_SPAWNED:
+            return;
+        case EVENT_EXPLOSION:
+            session->explosions++;
+            break;
+        default:
+            break;
+    }
+
+    session->events[session->eventTotal++ % SESSION_EVENT_CAPACITY] = *event;
+}
+
+void InitSessionStore(SessionStore *store) {
+    InitSlabPool(&store->pool, SESSION_BLOCK_SIZE, SESSIONS_PER_SLAB);
+    InitSlabPool(&store->undoPool, SESSION_UNDO_BLOCK_SIZE, UNDO_BLOCKS_PER_SLAB);
+    store->table = NULL;
+    store->freeIds = NULL;
+    store->freeIdCount = 0;
+    store->capacity = 0;
+    store->count = 0;
+}
+
+// Dobra a tabela de ids; só acontece quando todos os ids estão em uso
+static bool GrowSessionTable(SessionStore *store) {
+    int capacity = store->capacity > 0 ? store->capacity * 2 : SESSIONS_PER_SLAB;
+    Session **table = realloc(store->table, capacity * sizeof(Session *));
+    if (table == NULL) {
+        return false;
+    }
+    store->table = table;
+
+    int *freeIds = realloc(store->freeIds, capacity * sizeof(int));
+    if (freeIds == NULL) {
+        return false;
+    }
+    store->freeIds = freeIds;
+
+    for (int id = capacity - 1; id >= store->capacity; id--) {
+        store->table[id] = NULL;
+        store->freeIds[store->freeIdCount++] = id;
+    }
+    store->capacity = capacity;
+    return true;
+}
+
+Session *CreateSession(SessionStore *store, int owner, uint64_t seed) {
+    if (store->freeIdCount == 0 && !GrowSessionTable(store)) {
+        return NULL;
+    }
+
+    Session *session = SlabAlloc(&store->pool);
+    if (session == NULL) {
+        return NULL;
+    }
+
+    session->id = store->freeIds[--store->freeIdCount];
+    session->owner = owner;
+    session->prevOwned = -1;
+    session->nextOwned = -1;
+    session->clearedCells = 0;
+    session->explosions = 0;
+    session->eventTotal = 0;
+
+    InitArena(&session->arena, (unsigned char *)session + sizeof(Session), SESSION_BLOCK_SIZE - sizeof(Session));
+    session->events = ArenaAlloc(&session->arena, SESSION_EVENT_CAPACITY * sizeof(GameEvent), sizeof(int));
+    session->undo = NULL;
+
+    InitializeBoard(&session->board, seed);
+    session->board.onEvent = OnSessionEvent;
+    session->board.eventUserData = session;
+    ResolveCascade(&session->board); // O tabuleiro inicial pode já ter matches
+
+    store->table[session->id] = session;
+    store->count++;
+    return session;
+}
+
+void DestroySession(SessionStore *store, Session *session) {
+    if (session->undo != NULL) {
+        SlabFree(&store->undoPool, session->undo);
+    }
+    store->table[session->id] = NULL;
+    store->freeIds[store->freeIdCount++] = session->id;
+    store->count--;
+    SlabFree(&store->pool, session);
+}
+
+// Histórico da sessão, reservado na primeira chamada: o cabeçalho no início
+// do bloco e o buffer no resto. NULL se não houver memória (a jogada só não
+// fica desfazível)
+UndoHistory *GetSessionUndo(SessionStore *store, Session *session) {
+    if (session->undo == NULL) {
+        UndoHistory *undo = SlabAlloc(&store->undoPool);
+        if (undo == NULL) {
+            return NULL;
+        }
+        InitUndoHistory(undo, undo + 1, SESSION_UNDO_BLOCK_SIZE - sizeof(UndoHistory));
+        session->undo = undo;
+    }
+
+    return session->undo;
+}
+
+Session *FindSession(const SessionStore *store, int id) {
+    if (id < 0 || id >= store->capacity) {
+        return NULL;
+    }
+
+    return store->table[id];
+}
+
+// Memória reservada pelos blocos (sessões e históricos) e pelas tabelas de ids
+size_t GetSessionStoreBytes(const SessionStore *store) {
+    return GetSlabPoolBytes(&store->pool) + GetSlabPoolBytes(&store->undoPool) +
+           (size_t)store->capacity * (sizeof(Session *) + sizeof(int));
+}
+
+// O cabeçalho precisa caber no bloco junto com o buffer de eventos
+typedef char SessionFitsInBlock[sizeof(Session) + SESSION_EVENT_CAPACITY * sizeof(GameEvent) + sizeof(int) <= SESSION_BLOCK_SIZE ? 1 : -1];
@@ -0,0 +1,52 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "arena.h"
+#include "candy.h"
+#include "undo.h"
+
+#define SESSION_BLOCK_SIZE 512   // Bloco fixo de cada sessão (estado + arena)
+#define SESSIONS_PER_SLAB 4096   // Blocos reservados por malloc
+#define SESSION_EVENT_CAPACITY 4 // Eventos recentes guardados por sessão
+#define SESSION_UNDO_BLOCK_SIZE 1024 // Histórico de jogadas de uma sessão
+#define UNDO_BLOCKS_PER_SLAB 1024
+
+// Uma sessão ocupa exatamente um bloco do pool: o cabeçalho abaixo e, no
+// resto do bloco, uma arena com o buffer de eventos. O histórico de jogadas
+// fica num bloco à parte, reservado só na primeira jogada, para que sessões
+// paradas continuem custando um bloco
+typedef struct {
+    Board board;
+    int id;
+    int owner;       // Índice do cliente dono
+    int prevOwned;   // Lista das sessões do mesmo cliente (ids, -1 = fim)
+    int nextOwned;
+    int clearedCells; // Resultado do último comando
+    int explosions;
+    unsigned int eventTotal; // Eventos já gravados no buffer circular
+    GameEvent *events;       // SESSION_EVENT_CAPACITY eventos, na arena
+    UndoHistory *undo;       // NULL até a primeira jogada
+    Arena arena;             // Resto do bloco
+} Session;
+
+// Sessões indexadas por id, com ids livres reaproveitados em pilha
+typedef struct {
+    SlabPool pool;
+    SlabPool undoPool; // Blocos de SESSION_UNDO_BLOCK_SIZE: UndoHistory + buffer
+    Session **table;
+    int *freeIds;
+    int freeIdCount;
+    int capacity;
+    int count;
+} SessionStore;
+
+void InitSessionStore(SessionStore *store);
+Session *CreateSession(SessionStore *store, int owner, uint64_t seed);
+void DestroySession(SessionStore *store, Session *session);
+UndoHistory *GetSessionUndo(SessionStore *store, Session *session);
+Session *FindSession(const SessionStore *store, int id);
+size_t GetSessionStoreBytes(const SessionStore *store);
+
+#endif
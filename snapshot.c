@@ -0,0 +1,112 @@
+#include "snapshot.h"
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+static uint32_t Checksum(const unsigned char *data, size_t size) {
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+// Grava o estado em buffer; phase pode ser NULL. Retorna o tamanho gravado
+// ou 0 se não couber
+size_t SaveSnapshot(const Board *board, const DropPhase *phase, void *buffer, size_t capacity) {
+    size_t size = sizeof(SnapshotHeader) + BOARD_STATE_SIZE + (phase != NULL ? sizeof(DropPhase) : 0);
+    if (size > capacity) {
+        return 0;
+    }
+
+    unsigned char *out = buffer;
+    unsigned char *payload = out + sizeof(SnapshotHeader);
+    PackGrid(board, payload);
+    memcpy(payload + PACKED_GRID_SIZE, (const unsigned char *)board + BOARD_FIELDS_OFFSET, BOARD_FIELDS_SIZE);
+    if (phase != NULL) {
+        memcpy(payload + BOARD_STATE_SIZE, phase, sizeof(DropPhase));
+    }
+
+    SnapshotHeader header = {
+        SNAPSHOT_MAGIC,
+        SNAPSHOT_VERSION,
+        phase != NULL ? SNAPSHOT_HAS_DROP_PHASE : 0,
+        BOARD_STATE_SIZE,
+        Checksum(payload, size - sizeof(SnapshotHeader))
+    };
+    memcpy(out, &header, sizeof(header));
+    return size;
+}
+
+// Campos que vêm direto do arquivo e que as regras usam sem conferir. Os
+// buracos e o hash são recalculados e a fila de spawn é refeita, então não
+// precisam de validação
+static bool IsBoardStateValid(const Board *board) {
+    return board->score >= 0 && board->highscore >= 0 && board->baseScore > 0 &&
+           board->comboCount >= 0 && board->comboCount <= SHRT_MAX && // Os eventos guardam o combo em um short
+           board->rngState != 0;
+}
+
+static bool IsDropPhaseValid(const unsigned char *in) {
+    DropPhase phase;
+
+    // Um bool só pode valer 0 ou 1
+    if (in[offsetof(DropPhase, isDropping)] > 1) {
+        return false;
+    }
+    memcpy(&phase, in, sizeof(phase));
+
+    if (!isfinite(phase.dropTimer) || phase.dropTimer < 0.0f) {
+        return false;
+    }
+    for (int i = 0; i < GRID_CELLS; i++) {
+        if (!isfinite(phase.candyY[i]) || !isfinite(phase.candyVelY[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Restaura o estado mantendo o handler de eventos e o cache de spawn do
+// tabuleiro (refeito para o estado carregado); phase pode ser NULL e só é
+// alterada se o snapshot tiver a fase de queda. Snapshots de outra versão,
+// truncados, corrompidos ou com valores fora do intervalo são recusados sem
+// alterar nada
+bool LoadSnapshot(Board *board, DropPhase *phase, const void *buffer, size_t size) {
+    const unsigned char *in = buffer;
+    SnapshotHeader header;
+
+    if (size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, in, sizeof(header));
+
+    bool hasPhase = (header.flags & SNAPSHOT_HAS_DROP_PHASE) != 0;
+    size_t expected = sizeof(header) + BOARD_STATE_SIZE + (hasPhase ? sizeof(DropPhase) : 0);
+
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION ||
+        header.boardSize != BOARD_STATE_SIZE || size != expected ||
+        header.checksum != Checksum(in + sizeof(header), size - sizeof(header))) {
+        return false;
+    }
+
+    // Monta o estado numa cópia e só a aplica se tudo for válido
+    Board loaded = *board;
+    memcpy((unsigned char *)&loaded + BOARD_FIELDS_OFFSET, in + sizeof(header) + PACKED_GRID_SIZE, BOARD_FIELDS_SIZE);
+    if (!UnpackGrid(&loaded, in + sizeof(header)) || !IsBoardStateValid(&loaded) ||
+        (hasPhase && !IsDropPhaseValid(in + sizeof(header) + BOARD_STATE_SIZE))) {
+        return false;
+    }
+
+    *board = loaded;
+    RefillSpawnQueues(board);
+    if (phase != NULL && hasPhase) {
+        memcpy(phase, in + sizeof(header) + BOARD_STATE_SIZE, sizeof(DropPhase));
+    }
+
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "candy.h"
+#include "packed.h"
+
+#define SNAPSHOT_MAGIC 0x4E534243u // "CBSN"
+// Versões: 2 score em 64 bits; 3 buracos por coluna; 4 filas de spawn;
+// 5 grade em nibbles; 6 hash Zobrist
+#define SNAPSHOT_VERSION 6
+#define SNAPSHOT_HAS_DROP_PHASE 1 // flags: a fase de queda vem junto
+
+// Fase da queda/animação de um jogo em andamento
+typedef struct {
+    bool isDropping;
+    float dropTimer;             // Timer para controlar o tempo de queda
+    float candyY[GRID_CELLS];    // Posição animada (pixels)
+    float candyVelY[GRID_CELLS]; // Velocidade de queda (pixels/s)
+} DropPhase;
+
+// Cabeçalho seguido do estado do tabuleiro (a grade em 4 bits por célula e
+// os campos do Board até os ponteiros do handler de eventos) e,
+// opcionalmente, da DropPhase
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint32_t boardSize; // Detecta mudança de layout entre builds
+    uint32_t checksum;  // FNV-1a do conteúdo depois do cabeçalho
+} SnapshotHeader;
+
+#define BOARD_FIELDS_OFFSET offsetof(Board, score)
+#define BOARD_FIELDS_SIZE (offsetof(Board, onEvent) - BOARD_FIELDS_OFFSET)
+#define BOARD_STATE_SIZE (PACKED_GRID_SIZE + BOARD_FIELDS_SIZE)
+
+// Os campos gravados começam logo depois da grade
+typedef char BoardFieldsFollowGrid[BOARD_FIELDS_OFFSET == sizeof(((Board *)0)->grid) ? 1 : -1];
+#define SNAPSHOT_MAX_SIZE (sizeof(SnapshotHeader) + BOARD_STATE_SIZE + sizeof(DropPhase))
+
+size_t SaveSnapshot(const Board *board, const DropPhase *phase, void *buffer, size_t capacity);
+bool LoadSnapshot(Board *board, DropPhase *phase, const void *buffer, size_t size);
+
+#endif
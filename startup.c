@@ -0,0 +1,57 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "startup.h"
+#include "workers.h"
+
+#include <stdio.h>
+
+void BeginStartupProfile(StartupProfile *profile) {
+    profile->count = 0;
+    profile->origin = GetWallTime();
+}
+
+// Reserva a etapa com um incremento atômico; retorna -1 se não houver espaço
+int BeginStartupStep(StartupProfile *profile, const char *name) {
+    int step = __atomic_fetch_add(&profile->count, 1, __ATOMIC_RELAXED);
+
+    if (step >= MAX_STARTUP_STEPS) {
+        return -1;
+    }
+
+    profile->steps[step].name = name;
+    profile->steps[step].start = GetWallTime() - profile->origin;
+    profile->steps[step].duration = 0.0;
+    return step;
+}
+
+void EndStartupStep(StartupProfile *profile, int step) {
+    if (step >= 0) {
+        profile->steps[step].duration = GetWallTime() - profile->origin - profile->steps[step].start;
+    }
+}
+
+void PrintStartupProfile(const StartupProfile *profile) {
+    int count = profile->count < MAX_STARTUP_STEPS ? profile->count : MAX_STARTUP_STEPS;
+
+    printf("Inicializacao (ms):\n");
+    for (int i = 0; i < count; i++) {
+        const StartupStep *step = &profile->steps[i];
+        printf("  %-20s inicio %8.2f  duracao %8.2f\n", step->name, step->start * 1000.0, step->duration * 1000.0);
+    }
+}
+
+// Sem threads disponíveis a etapa roda na hora, na thread atual
+void StartStartupTask(StartupTask *task, void *(*run)(void *), void *arg) {
+    task->started = pthread_create(&task->thread, NULL, run, arg) == 0;
+
+    if (!task->started) {
+        run(arg);
+    }
+}
+
+void WaitStartupTask(StartupTask *task) {
+    if (task->started) {
+        pthread_join(task->thread, NULL);
+        task->started = false;
+    }
+}
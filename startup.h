@@ -0,0 +1,37 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#define MAX_STARTUP_STEPS 16
+
+typedef struct {
+    const char *name;
+    double start;    // Segundos desde o início do processo
+    double duration;
+} StartupStep;
+
+// Tempos de cada etapa da inicialização até o primeiro frame; as etapas
+// podem ser registradas de várias threads ao mesmo tempo
+typedef struct {
+    StartupStep steps[MAX_STARTUP_STEPS];
+    int count;
+    double origin;
+} StartupProfile;
+
+// Etapa da inicialização executada em uma thread de trabalho
+typedef struct {
+    pthread_t thread;
+    bool started;
+} StartupTask;
+
+void BeginStartupProfile(StartupProfile *profile);
+int BeginStartupStep(StartupProfile *profile, const char *name);
+void EndStartupStep(StartupProfile *profile, int step);
+void PrintStartupProfile(const StartupProfile *profile);
+
+void StartStartupTask(StartupTask *task, void *(*run)(void *), void *arg);
+void WaitStartupTask(StartupTask *task);
+
+#endif
@@ -0,0 +1,72 @@
+// Gera um header C com o conteúdo dos arquivos como vetores constantes,
+// para compilar o jogo sem depender da pasta resources/ (EMBED_RESOURCES).
+// Cada arquivo "nome.ext" vira nome_ext[] e nome_ext_size; os dados
+// recebem um '\0' extra no fim (não contado no tamanho).
+//
+// usage: embed.exe <header de saída> <arquivo> [arquivo...]
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+// Converte o nome do arquivo (sem pastas) em um identificador C
+void SymbolName(const char *path, char *symbol, size_t symbolSize) {
+    const char *name = path;
+
+    for (const char *c = path; *c != '\0'; c++) {
+        if (*c == '/' || *c == '\\') {
+            name = c + 1;
+        }
+    }
+
+    size_t i = 0;
+    for (; name[i] != '\0' && i < symbolSize - 1; i++) {
+        symbol[i] = isalnum((unsigned char)name[i]) ? name[i] : '_';
+    }
+    symbol[i] = '\0';
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        printf("usage: %s <header> <arquivo> [arquivo...]\n", argv[0]);
+        return 1;
+    }
+
+    FILE *output = fopen(argv[1], "w");
+    if (output == NULL) {
+        printf("Erro ao criar %s.\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(output, "// Gerado por tools/embed.c - nao editar\n\n");
+    fprintf(output, "#ifndef RESOURCES_EMBEDDED_H\n#define RESOURCES_EMBEDDED_H\n");
+
+    for (int i = 2; i < argc; i++) {
+        FILE *input = fopen(argv[i], "rb");
+        if (input == NULL) {
+            printf("Erro ao abrir %s.\n", argv[i]);
+            fclose(output);
+            return 1;
+        }
+
+        char symbol[64];
+        SymbolName(argv[i], symbol, sizeof(symbol));
+        fprintf(output, "\nstatic const unsigned char %s[] = {", symbol);
+
+        long size = 0;
+        int byte;
+        while ((byte = fgetc(input)) != EOF) {
+            fprintf(output, "%s0x%02x,", size % 16 == 0 ? "\n    " : " ", byte);
+            size++;
+        }
+        fprintf(output, "%s0x00\n};\n", size % 16 == 0 ? "\n    " : " ");
+        fprintf(output, "static const int %s_size = %ld;\n", symbol, size);
+
+        fclose(input);
+    }
+
+    fprintf(output, "\n#endif\n");
+    fclose(output);
+    printf("Recursos embutidos em %s.\n", argv[1]);
+    return 0;
+}
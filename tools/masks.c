@@ -0,0 +1,79 @@
+// Gera masks.c com as tabelas de masks.h para o tamanho de grade e os tipos
+// de candy.h. Rode de novo (make masks) se eles mudarem.
+//
+// usage: masks.exe <arquivo de saída>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "masks.h"
+
+void SetCell(uint64_t mask[MASK_WORDS], int x, int y) {
+    if (x >= 0 && x < GRID_WIDTH && y >= 0 && y < GRID_HEIGHT) {
+        int cell = y * GRID_WIDTH + x;
+        mask[cell / 64] |= 1ull << (cell % 64);
+    }
+}
+
+// Sequência fixa (splitmix64) para as chaves Zobrist serem sempre as mesmas
+uint64_t NextKey(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void WriteMask(FILE *output, const uint64_t mask[MASK_WORDS]) {
+    fprintf(output, "{ 0x%016llxull, 0x%016llxull },", (unsigned long long)mask[0], (unsigned long long)mask[1]);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        printf("usage: %s <arquivo de saida>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *output = fopen(argv[1], "w");
+    if (output == NULL) {
+        printf("Erro ao criar %s.\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(output, "// Gerado por tools/masks.c - nao editar\n\n");
+    fprintf(output, "#include \"masks.h\"\n\n");
+    fprintf(output, "#if GRID_WIDTH != %d || GRID_HEIGHT != %d || EXPLOSION_RADIUS != %d || NUM_CANDY_TYPES != %d\n",
+            GRID_WIDTH, GRID_HEIGHT, EXPLOSION_RADIUS, NUM_CANDY_TYPES);
+    fprintf(output, "#error \"masks.c desatualizado: rode make masks\"\n#endif\n\n");
+
+    fprintf(output, "const uint64_t explosionMasks[GRID_CELLS][MASK_WORDS] = {\n");
+    for (int cell = 0; cell < GRID_CELLS; cell++) {
+        uint64_t mask[MASK_WORDS] = { 0 };
+        int centerX = cell % GRID_WIDTH;
+        int centerY = cell / GRID_WIDTH;
+
+        for (int y = centerY - EXPLOSION_RADIUS; y <= centerY + EXPLOSION_RADIUS; y++) {
+            for (int x = centerX - EXPLOSION_RADIUS; x <= centerX + EXPLOSION_RADIUS; x++) {
+                SetCell(mask, x, y);
+            }
+        }
+
+        fprintf(output, "    ");
+        WriteMask(output, mask);
+        fprintf(output, "\n");
+    }
+    fprintf(output, "};\n\n");
+
+    uint64_t keyState = 0x43616E6479426F6Dull;
+    fprintf(output, "const uint64_t zobristKeys[GRID_CELLS][NUM_CANDY_TYPES] = {\n");
+    for (int cell = 0; cell < GRID_CELLS; cell++) {
+        fprintf(output, "    {");
+        for (int type = 0; type < NUM_CANDY_TYPES; type++) {
+            fprintf(output, " 0x%016llxull,", (unsigned long long)NextKey(&keyState));
+        }
+        fprintf(output, " },\n");
+    }
+    fprintf(output, "};\n");
+
+    fclose(output);
+    printf("Tabelas geradas em %s.\n", argv[1]);
+    return 0;
+}
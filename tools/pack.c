@@ -0,0 +1,83 @@
+// Empacota os recursos do jogo já decodificados (RGBA, PCM) em um único
+// arquivo que o jogo mapeia em memória na inicialização.
+//
+// usage: pack.exe [arquivo de saída]
+
+#include <raylib.h>
+#include <stdio.h>
+#include <string.h>
+#include "pak.h"
+
+#define MAX_ENTRIES 16
+
+typedef struct {
+    PakEntry entry;
+    const void *data;
+} PackItem;
+
+PackItem items[MAX_ENTRIES];
+int itemCount = 0;
+
+void AddItem(const char *name, PakEntryKind kind, const void *data, unsigned int size, const uint32_t params[4]) {
+    PackItem *item = &items[itemCount++];
+    memset(item, 0, sizeof(*item));
+    strncpy(item->entry.name, name, PAK_NAME_SIZE - 1);
+    item->entry.kind = kind;
+    item->entry.size = size;
+    memcpy(item->entry.params, params, sizeof(item->entry.params));
+    item->data = data;
+}
+
+int main(int argc, char **argv) {
+    const char *outputFile = argc > 1 ? argv[1] : PAK_FILE;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    Image icon = LoadImage("resources/iconeCandy.png");
+    ImageFormat(&icon, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    Wave pop = LoadWave("resources/Pop.wav");
+
+    if (icon.data == NULL || pop.data == NULL) {
+        printf("Erro ao carregar os recursos.\n");
+        return 1;
+    }
+
+    uint32_t iconParams[4] = { icon.width, icon.height, icon.format, 1 };
+    AddItem("iconeCandy", PAK_IMAGE, icon.data, GetPixelDataSize(icon.width, icon.height, icon.format), iconParams);
+
+    uint32_t popParams[4] = { pop.frameCount, pop.sampleRate, pop.sampleSize, pop.channels };
+    AddItem("Pop", PAK_WAVE, pop.data, pop.frameCount * pop.channels * (pop.sampleSize / 8), popParams);
+
+    // Dados alinhados logo após a tabela de entradas
+    uint32_t offset = sizeof(PakHeader) + itemCount * sizeof(PakEntry);
+    for (int i = 0; i < itemCount; i++) {
+        offset = (offset + PAK_ALIGNMENT - 1) & ~(uint32_t)(PAK_ALIGNMENT - 1);
+        items[i].entry.offset = offset;
+        offset += items[i].entry.size;
+    }
+
+    FILE *file = fopen(outputFile, "wb");
+    if (file == NULL) {
+        printf("Erro ao criar %s.\n", outputFile);
+        return 1;
+    }
+
+    PakHeader header = { { 'C', 'B', 'P', 'K' }, PAK_VERSION, itemCount, 0 };
+    fwrite(&header, sizeof(header), 1, file);
+    for (int i = 0; i < itemCount; i++) {
+        fwrite(&items[i].entry, sizeof(PakEntry), 1, file);
+    }
+
+    static const unsigned char padding[PAK_ALIGNMENT] = { 0 };
+    for (int i = 0; i < itemCount; i++) {
+        fwrite(padding, 1, items[i].entry.offset - ftell(file), file);
+        fwrite(items[i].data, 1, items[i].entry.size, file);
+    }
+
+    fclose(file);
+    printf("Recursos empacotados em %s (%u bytes).\n", outputFile, offset);
+
+    UnloadImage(icon);
+    UnloadWave(pop);
+    return 0;
+}
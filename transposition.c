@@ -0,0 +1,124 @@
+#include "transposition.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CACHE_LINE 64
+
+// data: value (32 bits) | depth + 1 (8) | geração (8) | move (16). A
+// profundidade guardada com + 1 garante que data de uma entrada usada
+// nunca é 0, o valor das entradas vazias
+static uint64_t PackEntry(int value, int depth, unsigned char generation, int move) {
+    if (depth > 254) {
+        depth = 254;
+    }
+
+    return (uint64_t)(uint32_t)value | (uint64_t)(depth + 1) << 32 |
+           (uint64_t)generation << 40 | (uint64_t)(uint16_t)move << 48;
+}
+
+static int EntryDepth(uint64_t data) {
+    return (int)((data >> 32) & 0xFF) - 1;
+}
+
+static unsigned char EntryGeneration(uint64_t data) {
+    return (unsigned char)(data >> 40);
+}
+
+// Usa a maior potência de 2 de buckets que cabe em bytes
+bool InitTranspositionTable(TranspositionTable *table, size_t bytes) {
+    size_t bucketSize = TT_BUCKET_ENTRIES * sizeof(TranspositionEntry);
+    size_t bucketCount = 1;
+    while (bucketCount * 2 * bucketSize <= bytes) {
+        bucketCount *= 2;
+    }
+
+    table->allocation = malloc(bucketCount * bucketSize + CACHE_LINE);
+    if (table->allocation == NULL) {
+        return false;
+    }
+
+    uintptr_t aligned = ((uintptr_t)table->allocation + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1);
+    table->entries = (TranspositionEntry *)aligned;
+    table->bucketMask = bucketCount - 1;
+    table->generation = 0;
+    ClearTranspositionTable(table);
+    return true;
+}
+
+void DestroyTranspositionTable(TranspositionTable *table) {
+    free(table->allocation);
+    table->allocation = NULL;
+    table->entries = NULL;
+}
+
+// Não pode rodar junto com uma busca
+void ClearTranspositionTable(TranspositionTable *table) {
+    memset(table->entries, 0, (table->bucketMask + 1) * TT_BUCKET_ENTRIES * sizeof(TranspositionEntry));
+}
+
+// Chamado entre buscas, com as threads paradas
+void NewTranspositionGeneration(TranspositionTable *table) {
+    table->generation++;
+}
+
+static TranspositionEntry *GetBucket(const TranspositionTable *table, uint64_t key) {
+    return &table->entries[(key & table->bucketMask) * TT_BUCKET_ENTRIES];
+}
+
+bool ProbeTransposition(const TranspositionTable *table, uint64_t key, TranspositionResult *result) {
+    TranspositionEntry *bucket = GetBucket(table, key);
+
+    for (int i = 0; i < TT_BUCKET_ENTRIES; i++) {
+        uint64_t data = __atomic_load_n(&bucket[i].data, __ATOMIC_RELAXED);
+        uint64_t check = __atomic_load_n(&bucket[i].check, __ATOMIC_RELAXED);
+
+        if (data != 0 && (check ^ data) == key) {
+            result->value = (int32_t)(uint32_t)data;
+            result->depth = EntryDepth(data);
+            result->move = (int)(data >> 48);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Substituição: a mesma posição é regravada se a avaliação nova for tão
+// profunda quanto a antiga ou se a antiga for de uma busca anterior. Senão
+// a vítima é a entrada vazia, de geração mais antiga ou mais rasa do bucket
+void StoreTransposition(TranspositionTable *table, uint64_t key, int64_t value, int depth, int move) {
+    if (value < INT32_MIN || value > INT32_MAX) {
+        return;
+    }
+
+    TranspositionEntry *bucket = GetBucket(table, key);
+    unsigned char generation = table->generation;
+    TranspositionEntry *victim = NULL;
+    int victimWorth = 0;
+
+    for (int i = 0; i < TT_BUCKET_ENTRIES; i++) {
+        uint64_t data = __atomic_load_n(&bucket[i].data, __ATOMIC_RELAXED);
+        uint64_t check = __atomic_load_n(&bucket[i].check, __ATOMIC_RELAXED);
+
+        if (data != 0 && (check ^ data) == key) {
+            if (depth < EntryDepth(data) && EntryGeneration(data) == generation) {
+                return;
+            }
+            victim = &bucket[i];
+            break;
+        }
+
+        // Entradas velhas valem menos que qualquer uma da busca atual
+        unsigned char age = (unsigned char)(generation - EntryGeneration(data));
+        int worth = data == 0 ? -1 : EntryDepth(data) - 256 * (age != 0);
+        if (victim == NULL || worth < victimWorth) {
+            victim = &bucket[i];
+            victimWorth = worth;
+        }
+    }
+
+    uint64_t data = PackEntry((int)value, depth, generation, move);
+    __atomic_store_n(&victim->check, key ^ data, __ATOMIC_RELAXED);
+    __atomic_store_n(&victim->data, data, __ATOMIC_RELAXED);
+}
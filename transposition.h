@@ -0,0 +1,42 @@
+#ifndef TRANSPOSITION_H
+#define TRANSPOSITION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TT_BUCKET_ENTRIES 4 // Entradas por bucket (4 * 16 bytes = uma linha de cache)
+#define TT_NO_MOVE 0xFFFF
+
+// Entrada sem lock: data guarda valor, profundidade, geração e jogada, e
+// check guarda key ^ data. Uma escrita rasgada por outra thread faz a
+// conferência falhar e a leitura vira um miss, em vez de um valor errado
+typedef struct {
+    uint64_t check;
+    uint64_t data;
+} TranspositionEntry;
+
+// Tabela de tamanho fixo compartilhada pelas threads de busca. Leituras e
+// escritas são atômicas por palavra, sem locks
+typedef struct {
+    TranspositionEntry *entries; // Alinhado à linha de cache
+    void *allocation;
+    size_t bucketMask;
+    unsigned char generation;    // Avança a cada busca nova (envelhece as entradas)
+} TranspositionTable;
+
+typedef struct {
+    int64_t value; // Valor avaliado da posição (guardado em 32 bits)
+    int depth;     // Profundidade (ou esforço) da avaliação
+    int move;      // Melhor jogada conhecida ou TT_NO_MOVE
+} TranspositionResult;
+
+bool InitTranspositionTable(TranspositionTable *table, size_t bytes);
+void DestroyTranspositionTable(TranspositionTable *table);
+void ClearTranspositionTable(TranspositionTable *table);
+void NewTranspositionGeneration(TranspositionTable *table);
+bool ProbeTransposition(const TranspositionTable *table, uint64_t key, TranspositionResult *result);
+// Valores fora de 32 bits não são guardados
+void StoreTransposition(TranspositionTable *table, uint64_t key, int64_t value, int depth, int move);
+
+#endif
@@ -0,0 +1,158 @@
+#include "undo.h"
+
+#include <string.h>
+
+// Layout de uma jogada no buffer (sem padding, lido com memcpy):
+//    scoreDelta (8) | cellCount (1) | spawnColumns (4) | cellCount * {índice, xor} |
+//    um delta de spawnCount (2) por coluna de spawnColumns | tamanho (2)
+// O tamanho no fim permite andar para trás a partir do cursor
+#define RECORD_HEADER_SIZE 13
+#define RECORD_TRAILER_SIZE 2
+#define RECORD_MAX_SIZE (RECORD_HEADER_SIZE + 2 * GRID_CELLS + 2 * GRID_WIDTH + RECORD_TRAILER_SIZE)
+
+void InitUndoHistory(UndoHistory *history, void *buffer, size_t capacity) {
+    history->data = buffer;
+    history->capacity = capacity;
+    ClearUndoHistory(history);
+}
+
+void ClearUndoHistory(UndoHistory *history) {
+    history->used = 0;
+    history->cursor = 0;
+}
+
+void BeginUndoMove(const Board *board, UndoCheckpoint *checkpoint) {
+    for (int i = 0; i < GRID_CELLS; i++) {
+        checkpoint->types[i] = board->grid[i / GRID_WIDTH][i % GRID_WIDTH].type;
+    }
+    checkpoint->score = board->score;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        checkpoint->spawnCount[x] = board->spawnCount[x];
+    }
+}
+
+// Tamanho da jogada que começa em offset (lido do cabeçalho)
+static size_t RecordSize(const UndoHistory *history, size_t offset) {
+    uint32_t spawnColumns;
+    memcpy(&spawnColumns, history->data + offset + 9, 4);
+    return RECORD_HEADER_SIZE + 2 * history->data[offset + 8] + 2 * __builtin_popcount(spawnColumns) + RECORD_TRAILER_SIZE;
+}
+
+// Descarta a jogada mais antiga para abrir espaço no fim do buffer
+static void DropOldestRecord(UndoHistory *history) {
+    size_t size = RecordSize(history, 0);
+
+    memmove(history->data, history->data + size, history->used - size);
+    history->used -= size;
+    history->cursor = history->cursor > size ? history->cursor - size : 0;
+}
+
+// Grava a diferença entre o checkpoint e o tabuleiro já assentado. Descarta
+// as jogadas refazíveis; retorna false se nada mudou ou se não coube
+bool CommitUndoMove(UndoHistory *history, const UndoCheckpoint *checkpoint, const Board *board) {
+    unsigned char record[RECORD_MAX_SIZE];
+    int cellCount = 0;
+
+    for (int i = 0; i < GRID_CELLS; i++) {
+        signed char type = board->grid[i / GRID_WIDTH][i % GRID_WIDTH].type;
+        if (type != checkpoint->types[i]) {
+            record[RECORD_HEADER_SIZE + 2 * cellCount] = (unsigned char)i;
+            record[RECORD_HEADER_SIZE + 2 * cellCount + 1] = (unsigned char)(type ^ checkpoint->types[i]);
+            cellCount++;
+        }
+    }
+
+    // Doces consumidos das filas de cada coluna
+    uint32_t spawnColumns = 0;
+    int size = RECORD_HEADER_SIZE + 2 * cellCount;
+    for (int x = 0; x < GRID_WIDTH; x++) {
+        uint16_t delta = (uint16_t)(board->spawnCount[x] - checkpoint->spawnCount[x]);
+        if (delta != 0) {
+            spawnColumns |= 1u << x;
+            memcpy(record + size, &delta, 2);
+            size += 2;
+        }
+    }
+
+    int64_t scoreDelta = board->score - checkpoint->score;
+    if (cellCount == 0 && scoreDelta == 0 && spawnColumns == 0) {
+        return false;
+    }
+
+    size += RECORD_TRAILER_SIZE;
+    uint16_t recordSize = (uint16_t)size;
+    memcpy(record, &scoreDelta, 8);
+    record[8] = (unsigned char)cellCount;
+    memcpy(record + 9, &spawnColumns, 4);
+    memcpy(record + size - RECORD_TRAILER_SIZE, &recordSize, RECORD_TRAILER_SIZE);
+
+    history->used = history->cursor;
+    if ((size_t)size > history->capacity) {
+        ClearUndoHistory(history);
+        return false;
+    }
+    while (history->capacity - history->used < (size_t)size) {
+        DropOldestRecord(history);
+    }
+
+    memcpy(history->data + history->used, record, size);
+    history->used += size;
+    history->cursor = history->used;
+    return true;
+}
+
+// Aplica a jogada que começa em offset; sign = -1 desfaz, +1 refaz
+static void ApplyRecord(const UndoHistory *history, size_t offset, Board *board, int sign) {
+    const unsigned char *record = history->data + offset;
+    int64_t scoreDelta;
+    uint32_t spawnColumns;
+    int cellCount = record[8];
+
+    memcpy(&scoreDelta, record, 8);
+    memcpy(&spawnColumns, record + 9, 4);
+
+    for (int i = 0; i < cellCount; i++) {
+        int cell = record[RECORD_HEADER_SIZE + 2 * i];
+        Candy *candy = &board->grid[cell / GRID_WIDTH][cell % GRID_WIDTH];
+        board->hash ^= GetCellKey(cell, candy->type);
+        candy->type ^= (signed char)record[RECORD_HEADER_SIZE + 2 * i + 1];
+        board->hash ^= GetCellKey(cell, candy->type);
+        candy->isMatched = false;
+    }
+
+    const unsigned char *deltas = record + RECORD_HEADER_SIZE + 2 * cellCount;
+    for (uint32_t columns = spawnColumns; columns != 0; columns &= columns - 1) {
+        uint16_t delta;
+        memcpy(&delta, deltas, 2);
+        deltas += 2;
+        board->spawnCount[__builtin_ctz(columns)] += sign * delta;
+    }
+
+    board->score += sign * scoreDelta;
+    CountColumnHoles(board);
+    RefillSpawnQueues(board);
+    board->comboCount = 0;
+}
+
+// O tabuleiro precisa estar assentado, como no fim da jogada gravada
+bool UndoMove(UndoHistory *history, Board *board) {
+    if (history->cursor == 0) {
+        return false;
+    }
+
+    uint16_t size;
+    memcpy(&size, history->data + history->cursor - RECORD_TRAILER_SIZE, RECORD_TRAILER_SIZE);
+    history->cursor -= size;
+    ApplyRecord(history, history->cursor, board, -1);
+    return true;
+}
+
+bool RedoMove(UndoHistory *history, Board *board) {
+    if (history->cursor == history->used) {
+        return false;
+    }
+
+    ApplyRecord(history, history->cursor, board, 1);
+    history->cursor += RecordSize(history, history->cursor);
+    return true;
+}
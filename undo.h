@@ -0,0 +1,35 @@
+#ifndef UNDO_H
+#define UNDO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "candy.h"
+
+// Estado do tabuleiro no início de uma jogada: o plano de tipos empacotado
+// (índice = y * GRID_WIDTH + x) mais o que a jogada pode mudar fora da grade
+typedef struct {
+    signed char types[GRID_CELLS];
+    int64_t score;
+    uint32_t spawnCount[GRID_WIDTH];
+} UndoCheckpoint;
+
+// Histórico de jogadas em um buffer fornecido por quem chama. Cada jogada
+// guarda só as células que mudaram (índice + XOR do tipo), então desfazer e
+// refazer aplicam o mesmo XOR. Com o buffer cheio, as jogadas mais antigas
+// são descartadas
+typedef struct {
+    unsigned char *data;
+    size_t capacity;
+    size_t used;   // Fim da última jogada gravada (inclui as refazíveis)
+    size_t cursor; // Fim da última jogada aplicada; depois dele, só refazer
+} UndoHistory;
+
+void InitUndoHistory(UndoHistory *history, void *buffer, size_t capacity);
+void ClearUndoHistory(UndoHistory *history);
+void BeginUndoMove(const Board *board, UndoCheckpoint *checkpoint);
+bool CommitUndoMove(UndoHistory *history, const UndoCheckpoint *checkpoint, const Board *board);
+bool UndoMove(UndoHistory *history, Board *board);
+bool RedoMove(UndoHistory *history, Board *board);
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "workers.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+int GetCoreCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int cores = (int)info.dwNumberOfProcessors;
+#else
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return cores > 0 ? cores : 1;
+}
+
+// Relógio monotônico em segundos, para orçamentos de tempo das buscas
+double GetWallTime(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+static void RunItems(WorkerPool *pool, int worker) {
+    for (;;) {
+        int item = __atomic_fetch_add(&pool->nextItem, 1, __ATOMIC_RELAXED);
+        if (item >= pool->itemCount) {
+            return;
+        }
+        pool->function(pool->context, item, worker);
+    }
+}
+
+static void *WorkerThread(void *arg) {
+    WorkerPool *pool = arg;
+    int worker = __atomic_fetch_add(&pool->nextWorkerId, 1, __ATOMIC_RELAXED);
+    unsigned int seenBatch = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->batch == seenBatch && !pool->isStopping) {
+            pthread_cond_wait(&pool->workReady, &pool->lock);
+        }
+        if (pool->isStopping) {
+            break;
+        }
+        seenBatch = pool->batch;
+        pthread_mutex_unlock(&pool->lock);
+
+        RunItems(pool, worker);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busyWorkers == 0) {
+            pthread_cond_signal(&pool->workDone);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+// threadCount <= 0 usa um núcleo a menos que o total (a thread que chama
+// RunWorkerPool completa a conta). Threads que não puderem ser criadas só
+// reduzem o paralelismo
+void InitWorkerPool(WorkerPool *pool, int threadCount) {
+    if (threadCount <= 0) {
+        threadCount = GetCoreCount() - 1;
+    }
+    if (threadCount > MAX_WORKERS) {
+        threadCount = MAX_WORKERS;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workReady, NULL);
+    pthread_cond_init(&pool->workDone, NULL);
+    pool->batch = 0;
+    pool->busyWorkers = 0;
+    pool->isStopping = false;
+    pool->itemCount = 0;
+    pool->nextItem = 0;
+    pool->threadCount = 0;
+    pool->nextWorkerId = 0;
+
+    for (int i = 0; i < threadCount; i++) {
+        if (pthread_create(&pool->threads[pool->threadCount], NULL, WorkerThread, pool) == 0) {
+            pool->threadCount++;
+        }
+    }
+}
+
+// Processa itemCount itens com todas as threads e só retorna quando nenhuma
+// delas está mais usando context
+void RunWorkerPool(WorkerPool *pool, WorkFunction function, void *context, int itemCount) {
+    pthread_mutex_lock(&pool->lock);
+    pool->function = function;
+    pool->context = context;
+    pool->itemCount = itemCount;
+    pool->nextItem = 0;
+    pool->busyWorkers = pool->threadCount;
+    pool->batch++;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->lock);
+
+    RunItems(pool, pool->threadCount);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busyWorkers > 0) {
+        pthread_cond_wait(&pool->workDone, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void DestroyWorkerPool(WorkerPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->isStopping = true;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->workReady);
+    pthread_cond_destroy(&pool->workDone);
+}
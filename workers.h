@@ -0,0 +1,39 @@
+#ifndef WORKERS_H
+#define WORKERS_H
+
+#include <pthread.h>
+#include <stdbool.h>
+
+#define MAX_WORKERS 64
+
+// Processa um item do lote; worker vai de 0 a threadCount (a thread que
+// chamou RunWorkerPool também trabalha, com o último índice)
+typedef void (*WorkFunction)(void *context, int item, int worker);
+
+// Threads criadas uma vez e reaproveitadas a cada lote. Os itens são
+// distribuídos por um contador atômico, então threads livres pegam mais
+typedef struct {
+    pthread_t threads[MAX_WORKERS];
+    int threadCount;
+    int nextWorkerId; // Índice de cada thread, tirado quando ela começa
+
+    pthread_mutex_t lock;
+    pthread_cond_t workReady;
+    pthread_cond_t workDone;
+    unsigned int batch;  // Lote atual; muda para acordar as threads
+    int busyWorkers;     // Threads ainda dentro do lote atual
+    bool isStopping;
+
+    WorkFunction function;
+    void *context;
+    int itemCount;
+    int nextItem;        // Próximo item livre (atômico)
+} WorkerPool;
+
+int GetCoreCount(void);
+double GetWallTime(void);
+void InitWorkerPool(WorkerPool *pool, int threadCount);
+void RunWorkerPool(WorkerPool *pool, WorkFunction function, void *context, int itemCount);
+void DestroyWorkerPool(WorkerPool *pool);
+
+#endif